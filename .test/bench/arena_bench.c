@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena_bench.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:46:58 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 06:46:58 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../get_next_line.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+// compilation (from this directory):
+// cc -O2 -I../.. arena_bench.c ../../get_next_line*.c -lpthread
+//    -o arena_bench
+// execution:
+// ./arena_bench [lines]
+// writes a corpus of short lines (10M by default) to a temporary file, then
+// reads all of it, keeps every line and drops them all at the end:
+// once with malloc'd lines + free(), once with an arena + gnl_arena_reset()
+
+static double	bench_now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+static int	bench_corpus(char *path, size_t lines)
+{
+	FILE	*f;
+	size_t	i;
+	int		fd;
+
+	fd = mkstemp(path);
+	if (fd < 0)
+		return (-1);
+	f = fdopen(fd, "w");
+	i = 0;
+	while (f && i < lines)
+	{
+		fprintf(f, "%zu,%zu\n", i * 7919 % 100000, i % 997);
+		i++;
+	}
+	if (!f || fclose(f))
+		return (-1);
+	return (0);
+}
+
+// one pass over the corpus, all lines are kept until the end of the pass
+static double	bench_pass(char *path, char **keep, t_gnl_arena *arena)
+{
+	t_gnl_opts		opts;
+	t_gnl_reader	*r;
+	size_t			n;
+	double			t;
+	int				fd;
+
+	memset(&opts, 0, sizeof(opts));
+	opts.arena = arena;
+	fd = open(path, O_RDONLY);
+	t = bench_now();
+	r = gnl_open(fd, &opts);
+	n = 0;
+	keep[n] = gnl_next(r);
+	while (keep[n])
+		keep[++n] = gnl_next(r);
+	if (arena)
+		gnl_arena_reset(arena);
+	while (!arena && n--)
+		free(keep[n]);
+	gnl_close(r);
+	t = bench_now() - t;
+	close(fd);
+	return (t);
+}
+
+int	main(int argc, char *argv[])
+{
+	char		path[32];
+	size_t		lines;
+	char		**keep;
+	t_gnl_arena	*arena;
+
+	lines = 10000000;
+	if (argc > 1)
+		lines = atol(argv[1]);
+	strcpy(path, "/tmp/arena_bench_XXXXXX");
+	keep = malloc((lines + 1) * sizeof(*keep));
+	arena = gnl_arena_new(0);
+	if (!keep || !arena || bench_corpus(path, lines) < 0)
+		return (1);
+	bench_pass(path, keep, arena);
+	printf("malloc: %.3f s\n", bench_pass(path, keep, NULL));
+	printf("arena:  %.3f s\n", bench_pass(path, keep, arena));
+	printf("malloc: %.3f s\n", bench_pass(path, keep, NULL));
+	printf("arena:  %.3f s\n", bench_pass(path, keep, arena));
+	unlink(path);
+	gnl_arena_free(arena);
+	free(keep);
+	return (0);
+}
@@ -0,0 +1,344 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gnl_bench.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:05:43 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:57:11 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../get_next_line.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+
+// see Makefile: make bench
+// execution:
+// ./gnl_bench [MiB per corpus] [dir] > bench.json
+// generates the corpora in dir (default /tmp), then reads each of them with
+// every method and prints one JSON object: lines/s, MB/s, read syscalls
+// (/proc/self/io syscr) and allocations (counting malloc wrappers below)
+
+typedef struct s_run
+{
+	size_t	lines;
+	size_t	bytes;
+}	t_run;
+
+typedef struct s_method
+{
+	char	*name;
+	void	(*fn)(int fd, size_t bs, t_run *run);
+	size_t	bs;
+}	t_method;
+
+static size_t	g_allocs;
+static size_t	g_probe;
+static size_t	g_probe_allocs;
+
+void	*__libc_malloc(size_t n);
+void	*__libc_calloc(size_t n, size_t size);
+void	*__libc_realloc(void *p, size_t n);
+
+// every allocation of the process goes through these, libc's own included
+void	*malloc(size_t n)
+{
+	g_allocs++;
+	return (__libc_malloc(n));
+}
+
+void	*calloc(size_t n, size_t size)
+{
+	g_allocs++;
+	return (__libc_calloc(n, size));
+}
+
+void	*realloc(void *p, size_t n)
+{
+	g_allocs++;
+	return (__libc_realloc(p, n));
+}
+
+static double	bench_now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+// read syscalls issued so far by this process
+// (reading /proc costs some too, g_probe of them and
+// g_probe_allocs allocations, subtracted by the caller)
+static size_t	bench_syscr(void)
+{
+	FILE	*f;
+	char	key[32];
+	size_t	val;
+	size_t	syscr;
+
+	syscr = 0;
+	f = fopen("/proc/self/io", "r");
+	while (f && fscanf(f, "%31[^:]: %zu\n", key, &val) == 2)
+		if (!strcmp(key, "syscr"))
+			syscr = val;
+	if (f)
+		fclose(f);
+	return (syscr);
+}
+
+/* ---------------------------------------------------------------- corpora */
+
+// one line of the given corpus kind, written to f; returns its length
+static size_t	corpus_line(FILE *f, char kind, size_t i)
+{
+	size_t	len;
+	size_t	j;
+
+	len = 1 + (i * 2654435761u >> 7) % 40;
+	if (kind == 'l' || (kind == 'm' && i % 16 == 0))
+		len = 1 + (i * 2654435761u >> 3) % 16384;
+	if (kind == 'm' && i % 7 == 0)
+		len = 0;
+	j = 0;
+	while (j < len)
+		fputc('a' + (i + j++) % 26, f);
+	fputc('\n', f);
+	return (len + 1);
+}
+
+// s: short lines, l: long lines, n: short lines without a final '\n',
+// h: one huge line without '\n', m: mixed short / long / empty lines
+static int	corpus_make(char *path, char kind, size_t size)
+{
+	FILE	*f;
+	size_t	done;
+	size_t	i;
+
+	f = fopen(path, "w");
+	if (!f)
+		return (-1);
+	done = 0;
+	i = 0;
+	while (kind == 'h' && done++ < size)
+		fputc('a' + done % 26, f);
+	while (kind != 'h' && done < size)
+		done += corpus_line(f, kind, i++);
+	if (kind == 'n')
+		fputs("no newline at the end", f);
+	return (fclose(f));
+}
+
+/* ---------------------------------------------------------------- methods */
+
+// get_next_line with a fixed read size (bs), like -D BUFFER_SIZE=bs
+static void	m_gnl(int fd, size_t bs, t_run *run)
+{
+	t_gnl_opts		opts;
+	t_gnl_reader	*r;
+	char			*line;
+
+	memset(&opts, 0, sizeof(opts));
+	opts.no_mmap = bs != 0;
+	opts.read_size = bs;
+	opts.read_max = bs;
+	r = gnl_open(fd, &opts);
+	line = gnl_next(r);
+	while (line)
+	{
+		run->lines++;
+		run->bytes += strlen(line);
+		free(line);
+		line = gnl_next(r);
+	}
+	gnl_close(r);
+}
+
+// zero-copy view, default reader (mmap on regular files)
+static void	m_gnl_view(int fd, size_t bs, t_run *run)
+{
+	t_gnl_reader	*r;
+	const char		*line;
+	size_t			len;
+
+	(void)bs;
+	r = gnl_open(fd, NULL);
+	while (gnl_next_view(r, &line, &len) == 1)
+	{
+		run->lines++;
+		run->bytes += len;
+	}
+	gnl_close(r);
+}
+
+static void	m_getline(int fd, size_t bs, t_run *run)
+{
+	FILE	*f;
+	char	*line;
+	size_t	cap;
+	ssize_t	len;
+
+	(void)bs;
+	f = fdopen(dup(fd), "r");
+	line = NULL;
+	cap = 0;
+	len = getline(&line, &cap, f);
+	while (len >= 0)
+	{
+		run->lines++;
+		run->bytes += len;
+		len = getline(&line, &cap, f);
+	}
+	free(line);
+	fclose(f);
+}
+
+// fgets() into a bs sized buffer, a line longer than that comes in pieces
+static void	m_fgets(int fd, size_t bs, t_run *run)
+{
+	FILE	*f;
+	char	*buf;
+	size_t	len;
+
+	f = fdopen(dup(fd), "r");
+	buf = malloc(bs);
+	while (fgets(buf, bs, f))
+	{
+		len = strlen(buf);
+		run->bytes += len;
+		if (buf[len - 1] == '\n' || feof(f))
+			run->lines++;
+	}
+	free(buf);
+	fclose(f);
+}
+
+// raw baseline: mmap() the file and memchr() from line to line
+static void	m_mmap(int fd, size_t bs, t_run *run)
+{
+	struct stat	sb;
+	char		*map;
+	char		*p;
+	char		*nl;
+
+	(void)bs;
+	if (fstat(fd, &sb) < 0 || sb.st_size == 0)
+		return ;
+	map = mmap(NULL, sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (map == MAP_FAILED)
+		return ;
+	madvise(map, sb.st_size, MADV_SEQUENTIAL);
+	p = map;
+	while (p < map + sb.st_size)
+	{
+		nl = memchr(p, '\n', map + sb.st_size - p);
+		if (!nl)
+			nl = map + sb.st_size - 1;
+		run->lines++;
+		p = nl + 1;
+	}
+	run->bytes = sb.st_size;
+	munmap(map, sb.st_size);
+}
+
+/* ---------------------------------------------------------------- driver */
+
+static const t_method	g_methods[] = {
+{"get_next_line", m_gnl, 42},
+{"get_next_line", m_gnl, 4096},
+{"get_next_line", m_gnl, 65536},
+{"get_next_line", m_gnl, 1048576},
+{"get_next_line_default", m_gnl, 0},
+{"get_next_line_view", m_gnl_view, 0},
+{"getline", m_getline, 0},
+{"fgets", m_fgets, 65536},
+{"mmap_memchr", m_mmap, 0},
+{NULL, NULL, 0}};
+
+static void	bench_one(char *corpus, char *path, const t_method *m)
+{
+	t_run	run;
+	size_t	sys;
+	size_t	allocs;
+	double	t;
+	int		fd;
+
+	memset(&run, 0, sizeof(run));
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return ;
+	sys = bench_syscr();
+	allocs = g_allocs;
+	t = bench_now();
+	m->fn(fd, m->bs, &run);
+	t = bench_now() - t;
+	sys = bench_syscr() - sys - g_probe;
+	allocs = g_allocs - allocs - g_probe_allocs;
+	close(fd);
+	printf("    {\"corpus\": \"%s\", \"method\": \"%s\", "
+		"\"buffer_size\": %zu, \"lines\": %zu, \"bytes\": %zu, "
+		"\"seconds\": %.6f, \"lines_per_s\": %.0f, \"mb_per_s\": %.1f, "
+		"\"read_syscalls\": %zu, \"allocations\": %zu}", corpus, m->name,
+		m->bs, run.lines, run.bytes, t, run.lines / t, run.bytes / t / 1e6,
+		sys, allocs);
+}
+
+// corpus number c (size bytes) in dir: made, read once to warm the page
+// cache, then by every method, and removed; -1 if it cannot be made
+static int	bench_corpus(char *dir, int c, size_t size)
+{
+	static char	*names[] = {"short", "long", "no_trailing_nl", "huge_line",
+		"mixed"};
+	char		path[4096];
+	int			fd;
+	int			m;
+
+	snprintf(path, sizeof(path), "%s/gnl_bench_%s", dir, names[c]);
+	if (corpus_make(path, "slnhm"[c], size) < 0)
+		return (-1);
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return (-1);
+	m_mmap(fd, 0, &(t_run){0, 0});
+	close(fd);
+	m = -1;
+	while (g_methods[++m].name)
+	{
+		if (c || m)
+			printf(",\n");
+		bench_one(names[c], path, &g_methods[m]);
+	}
+	unlink(path);
+	return (0);
+}
+
+int	main(int argc, char *argv[])
+{
+	char	*dir;
+	size_t	size;
+	int		c;
+
+	size = 32;
+	if (argc > 1)
+		size = atol(argv[1]);
+	dir = "/tmp";
+	if (argc > 2)
+		dir = argv[2];
+	g_probe = bench_syscr();
+	g_probe_allocs = g_allocs;
+	g_probe = bench_syscr() - g_probe;
+	g_probe_allocs = g_allocs - g_probe_allocs;
+	printf("{\n  \"mib_per_corpus\": %zu,\n  \"results\": [\n", size);
+	c = -1;
+	while (++c < 5)
+		if (bench_corpus(dir, c, size << 20) < 0)
+			return (1);
+	printf("\n  ]\n}\n");
+	return (0);
+}
@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   prefetch_bench.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:50:51 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:57:38 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../get_next_line.h"
+#include <stdio.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+
+// compilation (from this directory):
+// cc -O2 -I../.. prefetch_bench.c ../../get_next_line*.c -lpthread
+//    -o prefetch_bench
+// execution:
+// ./prefetch_bench [lines] [work_ns]
+// a child process plays slow storage (1 MiB blocks, 20 ms apart) on a pipe,
+// the consumer spends work_ns on every line; the histogram is the time
+// spent inside gnl_next(), i.e. blocked, without and with opts.prefetch
+
+#define BLOCK 1048576
+#define PAUSE_NS 20000000
+#define BUCKETS 24
+
+static double	bench_now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+// slow storage: the corpus in BLOCK sized writes (more than a pipe holds)
+// with a seek-like pause after each of them
+static void	bench_source(int fd, size_t lines)
+{
+	char			*buf;
+	size_t			len;
+	size_t			i;
+	struct timespec	pause;
+
+	pause.tv_sec = 0;
+	pause.tv_nsec = PAUSE_NS;
+	buf = malloc(BLOCK + 64);
+	len = 0;
+	i = 0;
+	while (buf && i < lines)
+	{
+		len += sprintf(buf + len, "%zu,%zu,some payload\n", i, i * 31 % 1000);
+		if (len >= BLOCK || ++i == lines)
+		{
+			if (write(fd, buf, len) < 0)
+				_exit(1);
+			nanosleep(&pause, NULL);
+			len = 0;
+		}
+	}
+	_exit(0);
+}
+
+// gnl_next() until EOF, work ns of busy "work" after each line; the time
+// of each call goes to its log2 bucket (ns) in hist, returns their sum
+static double	bench_loop(t_gnl_reader *r, long work, size_t *hist)
+{
+	char	*line;
+	double	t;
+	double	blocked;
+	int		b;
+
+	blocked = 0;
+	line = "";
+	while (line)
+	{
+		t = bench_now();
+		line = gnl_next(r);
+		t = bench_now() - t;
+		blocked += t;
+		b = 31 - __builtin_clz((unsigned)(t * 1e9) | 1);
+		if (b >= BUCKETS)
+			b = BUCKETS - 1;
+		hist[b]++;
+		free(line);
+		t = bench_now() + work / 1e9;
+		while (line && bench_now() < t)
+			;
+	}
+	return (blocked);
+}
+
+// one run: histogram of the time spent per gnl_next() call
+static void	bench_run(char *name, size_t lines, long work, t_gnl_opts *opts)
+{
+	size_t			hist[BUCKETS];
+	t_gnl_reader	*r;
+	double			t[2];
+	int				p[2];
+	int				b;
+
+	memset(hist, 0, sizeof(hist));
+	if (pipe(p) < 0)
+		exit(1);
+	if (fork() == 0)
+		bench_source(p[1], lines);
+	close(p[1]);
+	r = gnl_open(p[0], opts);
+	t[0] = bench_now();
+	t[1] = bench_loop(r, work, hist);
+	printf("%s: wall %.3f s, blocked in gnl_next %.3f s\n", name,
+		bench_now() - t[0], t[1]);
+	b = -1;
+	while (++b < BUCKETS)
+		if (hist[b])
+			printf("  < %8lu ns %10zu\n", 1UL << (b + 1), hist[b]);
+	gnl_close(r);
+	close(p[0]);
+	wait(NULL);
+}
+
+int	main(int argc, char *argv[])
+{
+	size_t		lines;
+	long		work;
+	t_gnl_opts	opts;
+
+	lines = 200000;
+	work = 500;
+	if (argc > 1)
+		lines = atol(argv[1]);
+	if (argc > 2)
+		work = atol(argv[2]);
+	memset(&opts, 0, sizeof(opts));
+	bench_run("read()", lines, work, &opts);
+	opts.prefetch = 1;
+	bench_run("prefetch", lines, work, &opts);
+	return (0);
+}
@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   scan_bench.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:37:26 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:57:38 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../get_next_line_int.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+// compilation (from this directory):
+// cc -O2 -I../.. scan_bench.c ../../get_next_line_scan.c
+//    ../../get_next_line_simd.c -o scan_bench
+// execution:
+// ./scan_bench [MiB] [line_len]
+// scans a buffer of 'a's with a '\n' every line_len bytes (0: none)
+// and prints GB/s for every scanner variant the cpu supports
+
+#define ROUNDS 20
+
+static double	bench_now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+// walk the whole buffer line by line, the way get_next_line does
+static size_t	bench_walk(t_scan scan, char *buf, size_t n)
+{
+	size_t	i;
+	size_t	lines;
+	char	*nl;
+
+	i = 0;
+	lines = 0;
+	while (i < n)
+	{
+		nl = scan(buf + i, '\n', n - i);
+		if (!nl)
+			break ;
+		i = nl - buf + 1;
+		lines++;
+	}
+	return (lines);
+}
+
+static void	bench_run(char *name, t_scan scan, char *buf, size_t n)
+{
+	double	t;
+	size_t	lines;
+	int		r;
+
+	lines = 0;
+	t = bench_now();
+	r = 0;
+	while (r++ < ROUNDS)
+		lines += bench_walk(scan, buf, n);
+	t = bench_now() - t;
+	printf("%-8s %8.2f GB/s  (%zu lines/round)\n", name,
+		(double)n * ROUNDS / t / 1e9, lines / ROUNDS);
+}
+
+// n bytes of 'a' with a '\n' every step bytes (0: none), NULL if out of memory
+static char	*bench_buf(size_t n, size_t step)
+{
+	char	*buf;
+	size_t	i;
+
+	buf = malloc(n);
+	if (!buf)
+		return (NULL);
+	memset(buf, 'a', n);
+	i = step;
+	while (step && i < n)
+	{
+		buf[i - 1] = '\n';
+		i += step;
+	}
+	return (buf);
+}
+
+int	main(int argc, char *argv[])
+{
+	size_t	n;
+	size_t	step;
+	char	*buf;
+
+	n = 256;
+	step = 0;
+	if (argc > 1)
+		n = atol(argv[1]);
+	if (argc > 2)
+		step = atol(argv[2]);
+	n <<= 20;
+	buf = bench_buf(n, step);
+	if (!buf)
+		return (1);
+	bench_run("swar", gnl_memchr_swar, buf, n);
+	__builtin_cpu_init();
+	if (GNL_X86 && __builtin_cpu_supports("sse2"))
+		bench_run("sse2", gnl_memchr_sse2, buf, n);
+	if (GNL_X86 && __builtin_cpu_supports("avx2"))
+		bench_run("avx2", gnl_memchr_avx2, buf, n);
+	if (GNL_X86 && __builtin_cpu_supports("avx512bw"))
+		bench_run("avx512", gnl_memchr_avx512, buf, n);
+	bench_run("memchr", (t_scan)memchr, buf, n);
+	free(buf);
+	return (0);
+}
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   crlf_cut.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:03:59 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 10:10:24 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../get_next_line.h"
+#include <stdio.h>
+#include <string.h>
+
+// opts.max_line with a "\r\n" delimiter right at the max_line boundary:
+// it must still end the line, including when the source hands out one
+// byte per read (the '\r' and the '\n' then come from two reads)
+
+typedef struct s_check_src
+{
+	const char	*text;
+	size_t		step;
+	t_gnl_src	gs;
+}	t_check_src;
+
+static ssize_t	check_read(void *ctx, char *buf, size_t n)
+{
+	t_check_src	*src;
+
+	src = ctx;
+	if (n > src->step)
+		n = src->step;
+	if (n > strlen(src->text))
+		n = strlen(src->text);
+	memcpy(buf, src->text, n);
+	src->text += n;
+	return (n);
+}
+
+// a max_line 4, "\r\n" reader on src
+static t_gnl_reader	*check_open(t_check_src *src)
+{
+	t_gnl_opts	opts;
+
+	src->gs.read = check_read;
+	src->gs.ctx = src;
+	memset(&opts, 0, sizeof(opts));
+	opts.max_line = 4;
+	opts.delim = "\r\n";
+	return (gnl_open_src(&src->gs, &opts));
+}
+
+// the chunks of text at max_line 4, as "more:chunk|" each
+static void	check_chunks(const char *text, size_t step, char *out)
+{
+	t_check_src		src;
+	t_gnl_reader	*r;
+	const char		*chunk;
+	size_t			len;
+	int				more;
+
+	src.text = text;
+	src.step = step;
+	r = check_open(&src);
+	*out = '\0';
+	while (gnl_next_chunk(r, &chunk, &len, &more) == 1)
+		sprintf(out + strlen(out), "%d:%.*s|", more, (int)len, chunk);
+	gnl_close(r);
+}
+
+static int	check(const char *text, const char *want)
+{
+	char	out[256];
+	size_t	step;
+
+	step = 1;
+	while (step <= 64)
+	{
+		check_chunks(text, step, out);
+		if (strcmp(out, want))
+		{
+			printf("crlf_cut: KO step %zu: \"%s\" instead of \"%s\"\n",
+				step, out, want);
+			return (1);
+		}
+		step *= 2;
+	}
+	return (0);
+}
+
+int	main(void)
+{
+	int	ko;
+
+	ko = check("abcd\r\nefg\r\n", "0:abcd\r\n|0:efg\r\n|");
+	ko |= check("abc\r\nd", "0:abc\r\n|0:d|");
+	ko |= check("abcde\r\nx\r\n", "1:abcd|0:e\r\n|0:x\r\n|");
+	ko |= check("abcd\r", "1:abcd|0:\r|");
+	ko |= check("abcdefgh", "1:abcd|0:efgh|");
+	if (!ko)
+		printf("crlf_cut: OK\n");
+	return (ko);
+}
@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   eof_errno.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:52:58 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:54:01 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../get_next_line.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+
+// a NULL line (-1 for gnl_getline) tells EOF from "no complete line yet":
+// errno EAGAIN while the O_NONBLOCK pipe is open and empty, then 0 at EOF,
+// for get_next_line(), gnl_getline() and gnl_next_match()
+
+// O_NONBLOCK pipe holding "xa\nxb" (no final '\n'): 0 if fn serves a line,
+// then EAGAIN while the pipe is open, the last line once it is closed, EOF
+// with errno 0 after
+static int	check_one(int (*fn)(int fd, t_gnl_reader *r))
+{
+	t_gnl_reader	*r;
+	int				p[2];
+	int				ko;
+
+	if (pipe(p) < 0 || fcntl(p[0], F_SETFL, O_NONBLOCK) < 0
+		|| write(p[1], "xa\nxb", 5) != 5)
+		return (1);
+	r = gnl_open(p[0], NULL);
+	ko = (fn(p[0], r) != 1);
+	errno = 0;
+	ko |= (fn(p[0], r) != 0 || errno != EAGAIN);
+	close(p[1]);
+	ko |= (fn(p[0], r) != 1);
+	errno = EAGAIN;
+	ko |= (fn(p[0], r) != 0 || errno != 0);
+	gnl_close(r);
+	gnl_close_fd(p[0]);
+	close(p[0]);
+	return (ko);
+}
+
+// one line from fd (or r): 1 if it came, 0 if not
+static int	check_gnl(int fd, t_gnl_reader *r)
+{
+	char	*line;
+
+	(void)r;
+	line = get_next_line(fd);
+	free(line);
+	return (line != NULL);
+}
+
+static int	check_getline(int fd, t_gnl_reader *r)
+{
+	char	*buf;
+	size_t	cap;
+	ssize_t	len;
+
+	(void)r;
+	buf = NULL;
+	cap = 0;
+	len = gnl_getline(fd, &buf, &cap);
+	free(buf);
+	return (len >= 0);
+}
+
+static int	check_match(int fd, t_gnl_reader *r)
+{
+	char	*line;
+
+	(void)fd;
+	line = gnl_next_match(r, "x");
+	free(line);
+	return (line != NULL);
+}
+
+int	main(void)
+{
+	if (check_one(check_gnl) || check_one(check_getline)
+		|| check_one(check_match))
+	{
+		printf("eof_errno: KO\n");
+		return (1);
+	}
+	printf("eof_errno: OK\n");
+	return (0);
+}
@@ -0,0 +1,33 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fd_bad.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:55:46 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:56:22 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../get_next_line_int.h"
+#include <errno.h>
+#include <stdio.h>
+
+// get_next_line() on a number that is not an open fd: NULL with EBADF,
+// and the fd table does not grow to cover it (INT_MAX would be ~63 MB)
+int	main(void)
+{
+	char	*line;
+
+	errno = 0;
+	line = get_next_line(INT_MAX);
+	if (line || errno != EBADF || gnl_fdtab()->npages)
+	{
+		printf("fd_bad: KO\n");
+		return (1);
+	}
+	gnl_reset_all();
+	printf("fd_bad: OK\n");
+	return (0);
+}
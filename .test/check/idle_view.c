@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   idle_view.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 08:49:50 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:55:33 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../get_next_line_int.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+
+// idle reclaim (gnl_idle_reclaim) against the fd readers:
+// - a view handed out by get_next_line_view() stays valid across sweeps,
+//   even when it is the last line of the stash (off == len)
+// - an idle fd with nothing unread is torn down, one with unread bytes (in
+//   its stash or its mapping) keeps them: its next lines are still there
+// run under ASan: a sweep that frees a viewed stash is a use-after-free
+
+// temporary file holding text n times, at offset 0
+static int	check_file(const char *text, int n)
+{
+	char	path[32];
+	FILE	*f;
+	int		fd;
+
+	strcpy(path, "/tmp/gnl_idle_XXXXXX");
+	fd = mkstemp(path);
+	f = fdopen(fd, "w");
+	if (!f)
+		return (-1);
+	unlink(path);
+	while (n--)
+		fputs(text, f);
+	fflush(f);
+	fd = dup(fileno(f));
+	fclose(f);
+	lseek(fd, 0, SEEK_SET);
+	return (fd);
+}
+
+static t_gnl_reader	*check_reader(int fd)
+{
+	return (&gnl_fdtab()->pages[fd / GNL_FD_PAGE][fd % GNL_FD_PAGE]);
+}
+
+// n calls on another fd: enough ticks for several sweeps
+// returns how many of them got a line
+static int	check_spin(int fd, int n)
+{
+	char	*line;
+	int		got;
+
+	got = 0;
+	while (n--)
+	{
+		line = get_next_line(fd);
+		got += (line != NULL);
+		free(line);
+	}
+	return (got);
+}
+
+// fd[3] is big enough to be mapped; NULL if all went as expected
+static const char	*check_sweep(int fd[5])
+{
+	const char	*view;
+	size_t		len;
+
+	free(get_next_line(fd[1]));
+	free(get_next_line(fd[2]));
+	free(get_next_line(fd[3]));
+	get_next_line_view(fd[0], &view, &len);
+	if (get_next_line_view(fd[0], &view, &len) != 1 || len != 4)
+		return ("view");
+	check_spin(fd[4], 300);
+	if (memcmp(view, "two\n", 4) || !check_reader(fd[0])->st.buf)
+		return ("view dropped by a sweep");
+	if (check_reader(fd[2])->st.buf || check_spin(fd[2], 1))
+		return ("idle fd with nothing unread kept");
+	if (check_spin(fd[1], 2) != 1 || check_spin(fd[3], 30000) != 19999)
+		return ("unread bytes dropped by a sweep");
+	if (get_next_line_view(fd[0], &view, &len) != 0)
+		return ("EOF");
+	return (NULL);
+}
+
+int	main(void)
+{
+	int			fd[5];
+	const char	*ko;
+
+	gnl_idle_reclaim(4);
+	fd[0] = check_file("one\ntwo\n", 1);
+	fd[1] = check_file("pending\nbytes\n", 1);
+	fd[2] = check_file("done\n", 1);
+	fd[3] = check_file("mapped line\n", 20000);
+	fd[4] = check_file("x\n", 300);
+	ko = "tmp files";
+	if (fd[0] >= 0 && fd[1] >= 0 && fd[2] >= 0 && fd[3] >= 0 && fd[4] >= 0)
+		ko = check_sweep(fd);
+	gnl_reset_all();
+	if (ko)
+		printf("idle_view: KO %s\n", ko);
+	else
+		printf("idle_view: OK\n");
+	return (ko != NULL);
+}
@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   index_stale.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 08:56:50 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 10:10:24 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../get_next_line_int.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+// line index sidecars (gnl_index_build / gnl_index_open):
+// - an index no longer matching its file (mtime) is refused
+// - a corrupted index (checksum) is refused
+// - a failed rebuild (EOVERFLOW) leaves the previous index as it was
+// the EOVERFLOW case uses a sparse file with a 4 GiB line
+
+#define IDX "/tmp/gnl_check.idx"
+
+static int	check_fail(const char *what)
+{
+	printf("index_stale: KO %s\n", what);
+	unlink(IDX);
+	return (1);
+}
+
+// a temporary file (already unlinked) holding text, at offset 'at'
+static int	check_file(const char *text, off_t at)
+{
+	char	path[32];
+	int		fd;
+
+	strcpy(path, "/tmp/gnl_idx_XXXXXX");
+	fd = mkstemp(path);
+	if (fd < 0)
+		return (-1);
+	unlink(path);
+	if (pwrite(fd, text, strlen(text), at) != (ssize_t)strlen(text))
+		return (-1);
+	return (fd);
+}
+
+// line n of fd through the index, compared with want
+static int	check_line(int fd, t_gnl_index *idx, size_t n, const char *want)
+{
+	t_gnl_reader	*r;
+	char			*line;
+	int				ok;
+
+	r = gnl_open(fd, NULL);
+	line = NULL;
+	if (r && gnl_seek_line(r, idx, n) == 0)
+		line = gnl_next(r);
+	ok = line && !strcmp(line, want);
+	free(line);
+	gnl_close(r);
+	return (ok);
+}
+
+// the index goes stale once its file's mtime changes, then it gets one of
+// its bytes flipped (past the header): both must be refused, then the
+// index is removed
+static const char	*check_stale(int fd)
+{
+	struct timespec	ts[2];
+	t_gnl_index		*idx;
+	char			c;
+	int				ifd;
+
+	ts[0].tv_nsec = UTIME_OMIT;
+	ts[1].tv_sec = 1;
+	ts[1].tv_nsec = 0;
+	futimens(fd, ts);
+	idx = gnl_index_open(IDX, -1);
+	if (gnl_index_open(IDX, fd) || !idx)
+		return ("stale index");
+	gnl_index_close(idx);
+	ifd = open(IDX, O_RDWR);
+	if (pread(ifd, &c, 1, sizeof(t_gnl_idx_hdr) + 1) == 1)
+	{
+		c ^= 1;
+		pwrite(ifd, &c, 1, sizeof(t_gnl_idx_hdr) + 1);
+	}
+	close(ifd);
+	if (gnl_index_open(IDX, -1))
+		return ("corrupted index");
+	unlink(IDX);
+	return (NULL);
+}
+
+int	main(void)
+{
+	t_gnl_index		*idx;
+	const char		*what;
+	int				fd[2];
+
+	fd[0] = check_file("one\ntwo\nthree\n", 0);
+	fd[1] = check_file("b\nc\n", (off_t)1 << 32);
+	if (fd[0] < 0 || fd[1] < 0 || pwrite(fd[1], "a\n", 2, 0) != 2)
+		return (check_fail("tmp files"));
+	if (gnl_index_build(fd[0], IDX, 1, 2) < 0)
+		return (check_fail("build"));
+	idx = gnl_index_open(IDX, fd[0]);
+	if (!idx || !check_line(fd[0], idx, 2, "three\n"))
+		return (check_fail("seek"));
+	gnl_index_close(idx);
+	if (gnl_index_build(fd[1], IDX, 1, 0) == 0 || errno != EOVERFLOW)
+		return (check_fail("no EOVERFLOW"));
+	idx = gnl_index_open(IDX, fd[0]);
+	if (!idx || !check_line(fd[0], idx, 1, "two\n") || !access(IDX ".tmp", 0))
+		return (check_fail("failed rebuild broke the old index"));
+	gnl_index_close(idx);
+	what = check_stale(fd[0]);
+	if (what)
+		return (check_fail(what));
+	printf("index_stale: OK\n");
+	return (0);
+}
@@ -0,0 +1,51 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mux_add.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:58:11 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 10:00:58 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../get_next_line_int.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+
+// gnl_mux_add() that fails leaves the fd's flags and the fd index as they
+// were; gnl_mux_next() that times out returns NULL with errno 0
+
+static int	check_fail(const char *what)
+{
+	printf("mux_add: KO %s\n", what);
+	return (1);
+}
+
+int	main(void)
+{
+	t_gnl_mux	*mux;
+	int			p[2];
+	int			fd;
+
+	mux = gnl_mux_new();
+	fd = open("../../get_next_line.h", O_RDONLY);
+	if (!mux || fd < 0 || pipe(p) < 0)
+		return (check_fail("setup"));
+	if (gnl_mux_add(mux, fd) != -1 || (fcntl(fd, F_GETFL) & O_NONBLOCK))
+		return (check_fail("regular file left O_NONBLOCK"));
+	if (gnl_mux_add(mux, INT_MAX) != -1 || mux->nfd)
+		return (check_fail("bad fd grew the index"));
+	if (gnl_mux_add(mux, p[0]) || gnl_mux_add(mux, p[0]) != -1)
+		return (check_fail("pipe"));
+	errno = EAGAIN;
+	if (gnl_mux_next(mux, &fd, 10) || errno != 0)
+		return (check_fail("timeout errno"));
+	gnl_mux_free(mux);
+	close(p[0]);
+	close(p[1]);
+	printf("mux_add: OK\n");
+	return (0);
+}
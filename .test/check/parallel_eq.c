@@ -0,0 +1,154 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parallel_eq.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:09:30 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 10:10:24 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../get_next_line.h"
+#include <dirent.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+
+// gnl_parallel() against a plain reader: for every fixture in .. and
+// several worker counts, the workers' lines put back in worker order must
+// be exactly the lines gnl_next_view() returns, byte for byte (binary-safe:
+// the pdf fixture holds '\0' bytes)
+
+#define CHECK_MAXW 64
+
+// the lines of one worker: their bytes end to end, and their lengths
+// (cap: allocated bytes of buf and of lines)
+typedef struct s_check_out
+{
+	char	*buf[CHECK_MAXW];
+	size_t	len[CHECK_MAXW];
+	size_t	*lines[CHECK_MAXW];
+	size_t	nlines[CHECK_MAXW];
+	size_t	cap[CHECK_MAXW][2];
+}	t_check_out;
+
+// *p (*cap bytes) grown x2 until it holds need bytes; 0 if out of memory
+static int	check_grow(void **p, size_t *cap, size_t need)
+{
+	void	*new;
+	size_t	size;
+
+	if (need <= *cap)
+		return (1);
+	size = *cap * 2 + 64;
+	while (size < need)
+		size *= 2;
+	new = realloc(*p, size);
+	if (!new)
+		return (0);
+	*p = new;
+	*cap = size;
+	return (1);
+}
+
+static int	check_collect(const char *line, size_t len, int worker, void *ctx)
+{
+	t_check_out	*out;
+
+	out = ctx;
+	if (!check_grow((void **)&out->buf[worker], &out->cap[worker][0],
+			out->len[worker] + len)
+		|| !check_grow((void **)&out->lines[worker], &out->cap[worker][1],
+			(out->nlines[worker] + 1) * sizeof(size_t)))
+		return (1);
+	memcpy(out->buf[worker] + out->len[worker], line, len);
+	out->len[worker] += len;
+	out->lines[worker][out->nlines[worker]++] = len;
+	return (0);
+}
+
+// walk the sequential lines of fd along out, 0 if they all match
+static int	check_compare(int fd, t_check_out *out)
+{
+	t_gnl_reader	*r;
+	const char		*line;
+	size_t			len;
+	int				w;
+	size_t			i[2];
+
+	r = gnl_open(fd, NULL);
+	w = 0;
+	memset(i, 0, sizeof(i));
+	while (r && gnl_next_view(r, &line, &len) == 1)
+	{
+		while (w < CHECK_MAXW && i[0] == out->nlines[w])
+		{
+			w++;
+			memset(i, 0, sizeof(i));
+		}
+		if (w == CHECK_MAXW || out->lines[w][i[0]] != len
+			|| memcmp(out->buf[w] + i[1], line, len))
+			break ;
+		i[1] += out->lines[w][i[0]++];
+	}
+	while (w < CHECK_MAXW && i[0] == out->nlines[w] && ++w < CHECK_MAXW)
+		i[0] = 0;
+	gnl_close(r);
+	return (w != CHECK_MAXW);
+}
+
+// one file of .., one worker count: 0 if gnl_parallel() matches
+static int	check_file(const char *name, int workers)
+{
+	t_check_out	out;
+	char		path[512];
+	int			fd;
+	int			ko;
+	int			w;
+
+	memset(&out, 0, sizeof(out));
+	snprintf(path, sizeof(path), "../%s", name);
+	fd = open(path, O_RDONLY);
+	ko = (fd < 0 || gnl_parallel(fd, workers, check_collect, &out) < 0
+			|| check_compare(fd, &out));
+	if (ko)
+		printf("parallel_eq: KO %s, %d workers\n", path, workers);
+	w = 0;
+	while (w < CHECK_MAXW)
+	{
+		free(out.buf[w]);
+		free(out.lines[w++]);
+	}
+	if (fd >= 0)
+		close(fd);
+	return (ko);
+}
+
+int	main(void)
+{
+	static const int	workers[] = {1, 2, 3, 4, 7, 16, CHECK_MAXW};
+	DIR					*dir;
+	struct dirent		*ent;
+	size_t				i;
+	int					ko;
+
+	ko = 0;
+	dir = opendir("..");
+	ent = NULL;
+	if (dir)
+		ent = readdir(dir);
+	while (ent)
+	{
+		i = 0;
+		while (ent->d_type == DT_REG && i < sizeof(workers) / sizeof(*workers))
+			ko |= check_file(ent->d_name, workers[i++]);
+		ent = readdir(dir);
+	}
+	if (dir)
+		closedir(dir);
+	if (!ko && dir)
+		printf("parallel_eq: OK\n");
+	return (ko || !dir);
+}
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   prefetch_err.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:08:22 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:52:25 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../get_next_line.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+
+// opts.prefetch: the read-ahead thread's errors reach the caller as they
+// would without it (errno included), and EAGAIN is handed back instead of
+// the thread spinning on it
+
+// "line\n" 'n' times, then every read fails with err
+typedef struct s_check_src
+{
+	int	n;
+	int	err;
+	int	calls;
+}	t_check_src;
+
+static ssize_t	check_read(void *ctx, char *buf, size_t n)
+{
+	t_check_src	*src;
+
+	src = ctx;
+	src->calls++;
+	if (src->n && n >= 5)
+	{
+		src->n--;
+		memcpy(buf, "line\n", 5);
+		return (5);
+	}
+	errno = src->err;
+	return (-1);
+}
+
+// lines served before the first NULL, errno then in *err
+static int	check_src(t_check_src *src, int *err)
+{
+	t_gnl_opts		opts;
+	t_gnl_src		gs;
+	t_gnl_reader	*r;
+	char			*line;
+	int				lines;
+
+	memset(&opts, 0, sizeof(opts));
+	opts.prefetch = 1;
+	gs.read = check_read;
+	gs.ctx = src;
+	r = gnl_open_src(&gs, &opts);
+	lines = 0;
+	errno = 0;
+	line = gnl_next(r);
+	while (line && ++lines)
+	{
+		free(line);
+		line = gnl_next(r);
+	}
+	*err = errno;
+	gnl_close(r);
+	return (lines);
+}
+
+static int	check_fail(const char *what)
+{
+	printf("prefetch_err: KO %s\n", what);
+	return (1);
+}
+
+int	main(void)
+{
+	t_check_src		src;
+	t_gnl_reader	*r;
+	t_gnl_opts		opts;
+	int				err;
+
+	src = (t_check_src){3, EIO, 0};
+	if (check_src(&src, &err) != 3 || err != EIO)
+		return (check_fail("EIO from a source"));
+	src = (t_check_src){2, EAGAIN, 0};
+	if (check_src(&src, &err) != 2 || err != EAGAIN || src.calls > 4)
+		return (check_fail("EAGAIN from a source"));
+	memset(&opts, 0, sizeof(opts));
+	opts.prefetch = 1;
+	opts.no_mmap = 1;
+	r = gnl_open(1000, &opts);
+	errno = 0;
+	if (!r || gnl_next(r) || errno != EBADF)
+		return (check_fail("EBADF from an fd"));
+	gnl_close(r);
+	printf("prefetch_err: OK\n");
+	return (0);
+}
@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   prefetch_poll.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:50:32 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:52:25 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../get_next_line.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+
+// opts.prefetch on an O_NONBLOCK pipe, driven by poll() the way an event
+// loop does: every complete line written so far must come out before poll()
+// times out, none may sit in a read-ahead buffer behind a drained fd
+
+static const char	*g_bursts[] = {"one\ntw", "o\n", "three\nfour\n", "fi",
+	"ve\n", "six\n", NULL};
+
+// poll() and take lines until the fd stays quiet, appending them to got
+static void	check_drain(t_gnl_reader *r, int fd, char *got)
+{
+	struct pollfd	pfd;
+	char			*line;
+
+	pfd.fd = fd;
+	pfd.events = POLLIN;
+	while (poll(&pfd, 1, 100) > 0)
+	{
+		line = gnl_next(r);
+		while (line)
+		{
+			strcat(got, line);
+			free(line);
+			line = gnl_next(r);
+		}
+		if (errno != EAGAIN)
+			return ;
+	}
+}
+
+static int	check_bursts(t_gnl_reader *r, int p[2])
+{
+	char	sent[256];
+	char	got[256];
+	int		i;
+
+	sent[0] = '\0';
+	got[0] = '\0';
+	i = -1;
+	while (g_bursts[++i])
+	{
+		strcat(sent, g_bursts[i]);
+		if (write(p[1], g_bursts[i], strlen(g_bursts[i])) < 0)
+			return (1);
+		check_drain(r, p[0], got);
+		if (strncmp(got, sent, strrchr(sent, '\n') + 1 - sent)
+			|| strlen(got) != (size_t)(strrchr(sent, '\n') + 1 - sent))
+			return (1);
+	}
+	return (0);
+}
+
+int	main(void)
+{
+	t_gnl_opts		opts;
+	t_gnl_reader	*r;
+	int				p[2];
+	int				ko;
+
+	if (pipe(p) < 0 || fcntl(p[0], F_SETFL, O_NONBLOCK) < 0)
+		return (1);
+	memset(&opts, 0, sizeof(opts));
+	opts.prefetch = 1;
+	r = gnl_open(p[0], &opts);
+	ko = (!r || check_bursts(r, p));
+	gnl_close(r);
+	close(p[0]);
+	close(p[1]);
+	if (ko)
+		printf("prefetch_poll: KO\n");
+	else
+		printf("prefetch_poll: OK\n");
+	return (ko);
+}
@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ring_opts.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:03:37 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 10:05:38 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../get_next_line.h"
+#include <stdio.h>
+#include <string.h>
+
+// gnl_ring_add opts reach the fd's reader: "\r\n" lines, stripped, come
+// back as "x", "y" and the unterminated "z" (io_uring and poll() engines)
+static int	check_ring(int flags)
+{
+	t_gnl_opts	opts;
+	t_gnl_ring	*ring;
+	char		got[16];
+	char		*line;
+	int			p[2];
+
+	memset(&opts, 0, sizeof(opts));
+	opts.delim = "\r\n";
+	opts.strip = 1;
+	ring = gnl_ring_new(1, flags);
+	got[0] = '\0';
+	if (!ring || pipe(p) < 0 || write(p[1], "x\r\ny\r\nz", 7) != 7
+		|| close(p[1]) < 0 || gnl_ring_add(ring, p[0], &opts) < 0)
+		return (1);
+	line = gnl_ring_next(ring, p + 1);
+	while (line && strlen(got) + strlen(line) < sizeof(got) - 1)
+	{
+		strcat(strcat(got, line), "|");
+		free(line);
+		line = gnl_ring_next(ring, p + 1);
+	}
+	free(line);
+	gnl_ring_free(ring);
+	close(p[0]);
+	return (strcmp(got, "x|y|z|") != 0);
+}
+
+int	main(void)
+{
+	if (check_ring(0) || check_ring(GNL_RING_POLL))
+	{
+		printf("ring_opts: KO\n");
+		return (1);
+	}
+	printf("ring_opts: OK\n");
+	return (0);
+}
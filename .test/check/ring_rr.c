@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ring_rr.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:26:27 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 10:05:38 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../get_next_line.h"
+#include <stdio.h>
+#include <string.h>
+
+// gnl_ring_next: fds that all have lines buffered are served one line each
+// in turn, not one fd drained before the next (io_uring and poll() engines)
+
+// three pipes holding 3 lines each, read through ring
+static int	check_open(t_gnl_ring *ring, int p[3][2])
+{
+	int	i;
+
+	i = -1;
+	while (++i < 3)
+		if (pipe(p[i]) < 0 || write(p[i][1], "a\nb\nc\n", 6) != 6
+			|| close(p[i][1]) < 0 || gnl_ring_add(ring, p[i][0], NULL) < 0)
+			return (-1);
+	return (0);
+}
+
+// every fd must come back once per round of 3 lines, then no line is left
+static int	check_ring(int flags)
+{
+	t_gnl_ring	*ring;
+	int			p[3][2];
+	int			seen[3];
+	int			i;
+	int			fd;
+
+	ring = gnl_ring_new(3, flags);
+	if (!ring || check_open(ring, p) < 0)
+		return (1);
+	i = -1;
+	while (++i < 9)
+	{
+		if (i % 3 == 0)
+			memset(seen, 0, sizeof(seen));
+		free(gnl_ring_next(ring, &fd));
+		fd = (fd == p[1][0]) + 2 * (fd == p[2][0]);
+		if (seen[fd]++)
+			break ;
+	}
+	fd = (i < 9 || gnl_ring_next(ring, &fd));
+	gnl_ring_free(ring);
+	i = -1;
+	while (++i < 3)
+		close(p[i][0]);
+	return (fd);
+}
+
+int	main(void)
+{
+	if (check_ring(0) || check_ring(GNL_RING_POLL))
+	{
+		printf("ring_rr: KO\n");
+		return (1);
+	}
+	printf("ring_rr: OK\n");
+	return (0);
+}
@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   swar.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:12:40 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:19:32 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../get_next_line_int.h"
+#include <stdio.h>
+#include <string.h>
+
+// the word-at-a-time scanners against the C library, with the target
+// byte c next to c ^ 0x01 and c ^ 0xff bytes (the 0x00 / 0x01 pairs of
+// x = word ^ c that fool the classic zero-byte test by a borrow), at every
+// alignment and position in a window of a few words
+
+#define CHECK_LEN 40
+
+static int	check_fail(const char *what, int c, size_t at, size_t pos)
+{
+	printf("swar: KO %s: c %#x, start %zu, target %zu\n", what, c, at, pos);
+	return (1);
+}
+
+static size_t	check_count(const char *s, int c, size_t n)
+{
+	size_t	count;
+
+	count = 0;
+	while (n--)
+		count += (s[n] == (char)c);
+	return (count);
+}
+
+static char	*check_last(char *s, int c, size_t n)
+{
+	while (n--)
+		if (s[n] == (char)c)
+			return (s + n);
+	return (NULL);
+}
+
+// one layout: buf filled with filler, c at pos (and pos + 2), c ^ 1 around
+static int	check_one(char *buf, int c, size_t at, size_t pos)
+{
+	char	*s;
+	size_t	n;
+
+	memset(buf, c ^ 0xFF, CHECK_LEN + 16);
+	s = buf + at;
+	n = CHECK_LEN;
+	s[pos] = c;
+	if (pos > 0)
+		s[pos - 1] = c ^ 1;
+	if (pos + 1 < n)
+		s[pos + 1] = c ^ 1;
+	if (pos + 2 < n && pos % 3 == 0)
+		s[pos + 2] = c;
+	if (gnl_memchr_swar(s, c, n) != memchr(s, c, n))
+		return (check_fail("gnl_memchr_swar", c, at, pos));
+	if (gnl_memchr(s, c, n) != memchr(s, c, n))
+		return (check_fail("gnl_memchr", c, at, pos));
+	if (gnl_memrchr(s, c, n) != check_last(s, c, n))
+		return (check_fail("gnl_memrchr", c, at, pos));
+	if (gnl_memcount_swar(s, c, n) != check_count(s, c, n)
+		|| gnl_memcount(s, c, n) != check_count(s, c, n))
+		return (check_fail("gnl_memcount", c, at, pos));
+	return (0);
+}
+
+int	main(void)
+{
+	static const int	cs[] = {0x00, 0x01, '\n', 0x7F, 0x80, 0xFE, 0xFF};
+	char				buf[CHECK_LEN + 16];
+	size_t				i;
+	size_t				at;
+	size_t				pos;
+
+	i = 0;
+	while (i < sizeof(cs) / sizeof(*cs))
+	{
+		at = 0;
+		while (at < 8)
+		{
+			pos = 0;
+			while (pos < CHECK_LEN)
+				if (check_one(buf, cs[i], at, pos++))
+					return (1);
+			at++;
+		}
+		i++;
+	}
+	printf("swar: OK\n");
+	return (0);
+}
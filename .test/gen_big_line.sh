@@ -0,0 +1,13 @@
+#!/bin/sh
+# generates big_line_<N>M_with_nl / big_line_<N>M_no_nl next to this script:
+# the big_line_* pattern (0123456789...) over N MiB, for each N given
+# (default 256), to stress opts.max_line / gnl_next_chunk()
+# usage: .test/gen_big_line.sh [MiB...]
+dir=$(dirname "$0")
+[ $# -eq 0 ] && set -- 256
+for n in "$@"; do
+	yes 0123456789 | tr -d '\n' | head -c $((n * 1048576)) \
+		> "$dir/big_line_${n}M_no_nl"
+	cp "$dir/big_line_${n}M_no_nl" "$dir/big_line_${n}M_with_nl"
+	echo >> "$dir/big_line_${n}M_with_nl"
+done
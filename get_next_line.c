@@ -6,101 +6,46 @@
 /*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/17 11:30:12 by anemet            #+#    #+#             */
-/*   Updated: 2025/07/21 15:51:29 by anemet           ###   ########.fr       */
+/*   Updated: 2026/10/18 08:51:35 by anemet           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "get_next_line.h"
+#include "get_next_line_int.h"
 
-static char	*gnl_free(char *buf)
-{
-	free(buf);
-	return (NULL);
-}
-
-// fill stash until '\n' in stash or EOF
-// read() returns nr of bytes read
-// new stash = old stash + buf // gnl_strjoin frees old stash
-static char	*gnl_read(int fd, char *stash)
-{
-	char	*buf;
-	int		rd;
-
-	buf = malloc(BUFFER_SIZE + 1);
-	if (!buf)
-		return (NULL);
-	rd = 1;
-	while (!gnl_strchr(stash, '\n') && rd > 0)
-	{
-		rd = read(fd, buf, BUFFER_SIZE);
-		if (rd < 0)
-			return (gnl_free(buf));
-		buf[rd] = '\0';
-		stash = gnl_strjoin(stash, buf);
-		if (!stash)
-			return (gnl_free(buf));
-	}
-	free(buf);
-	return (stash);
-}
+// plain fd interface: every fd gets a default reader (see gnl_fd_reader)
+// those readers are shared process-wide, use gnl_open() for threads
 
-// throws away the last served line and returns the tail (if any)
-static char	*gnl_new_stash(char *stash)
+// returns a malloc'd copy of the next line (including '\n' if present)
+char	*get_next_line(int fd)
 {
-	size_t	i;
-	char	*new;
-
-	i = 0;
-	while (stash[i] && stash[i] != '\n')
-		i++;
-	if (!stash[i])
-	{
-		free(stash);
-		return (0);
-	}
-	new = gnl_substr(stash, i + 1, gnl_strlen(stash + i + 1));
-	free(stash);
-	return (new);
+	return (gnl_next(gnl_fd_reader(fd)));
 }
 
-// returns a copy of the first complete line (including '\n' if present)
-static char	*gnl_get_line(char *stash)
+// zero-copy variant, see gnl_next_view()
+// the view also survives idle reclaim until the next call on fd
+int	get_next_line_view(int fd, const char **line, size_t *len)
 {
-	size_t	i;
-	char	*line;
+	t_gnl_reader	*r;
+	int				ret;
 
-	if (!stash || !stash[0])
-		return (NULL);
-	i = 0;
-	while (stash[i] && stash[i] != '\n')
-		i++;
-	if (stash[i] == '\n')
-		i++;
-	line = gnl_substr(stash, 0, i);
-	return (line);
+	r = gnl_fd_reader(fd);
+	ret = gnl_next_view(r, line, len);
+	if (r)
+		r->view = (ret == 1);
+	return (ret);
 }
 
-// stash[fd] keeps whatever was read from file, but not yet returned to caller
-char	*get_next_line(int fd)
+// getline()-style variant, see gnl_next_getline()
+ssize_t	gnl_getline(int fd, char **buf, size_t *cap)
 {
-	static char	*stash[OPEN_MAX];
-	char		*line;
-
-	if (fd < 0 || fd >= OPEN_MAX || BUFFER_SIZE <= 0)
-		return (NULL);
-	stash[fd] = gnl_read(fd, stash[fd]);
-	if (!stash[fd])
-		return (NULL);
-	line = gnl_get_line(stash[fd]);
-	stash[fd] = gnl_new_stash(stash[fd]);
-	return (line);
+	return (gnl_next_getline(gnl_fd_reader(fd), buf, cap));
 }
 /*
 #include <fcntl.h>
 #include <stdio.h>
 
 // compilation:
-// cc [-D BUFFER_SIZE=42] get_next_line.c get_next_line_utils.c
+// cc [-D BUFFER_SIZE=42] get_next_line*.c
 // execution:
 // ./a.out [file]
 // ./a.out /dev/tty
@@ -6,7 +6,7 @@
 /*   By: anemet <anemet@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/17 09:40:29 by anemet            #+#    #+#             */
-/*   Updated: 2025/06/17 14:56:00 by anemet           ###   ########.fr       */
+/*   Updated: 2026/10/18 10:05:38 by anemet           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,18 +17,169 @@
 #  define BUFFER_SIZE 42
 # endif
 
-# ifndef OPEN_MAX
-#  define OPEN_MAX 1024
-# endif
+// no complete line yet on an O_NONBLOCK fd (EAGAIN), the stash is kept
+// the calls that return a line pointer return NULL instead, with errno
+// EAGAIN; they also return NULL at EOF, with errno 0, and on error
+# define GNL_AGAIN -2
 
 # include <limits.h>
 # include <stdlib.h>
 # include <unistd.h>
 
-char	*get_next_line(int fd);
-size_t	gnl_strlen(char *s);
-char	*gnl_strchr(char *s, int c);
-char	*gnl_strjoin(char *s1, char *s2);
-char	*gnl_substr(char *s, unsigned int start, size_t len);
+// a line reader on one fd, owning its own stash (see gnl_open)
+typedef struct s_gnl_reader	t_gnl_reader;
+
+// bump allocator for lines, see gnl_arena_new()
+typedef struct s_gnl_arena	t_gnl_arena;
+
+// many fds read at once (io_uring, or poll() fallback), see gnl_ring_new()
+typedef struct s_gnl_ring	t_gnl_ring;
+
+// epoll-driven multiplexer over many O_NONBLOCK fds, see gnl_mux_next()
+typedef struct s_gnl_mux	t_gnl_mux;
+
+// byte producer behind a reader (see gnl_open_src), read() contract:
+// up to n bytes into buf, 0 at the end of the data, -1 with errno set on
+// error (EAGAIN: nothing yet, the reader then returns GNL_AGAIN)
+typedef ssize_t				(*t_gnl_read_fn)(void *ctx, char *buf, size_t n);
+
+typedef struct s_gnl_src
+{
+	t_gnl_read_fn	read;
+	void			*ctx;
+}	t_gnl_src;
+
+// last line first reader on a seekable fd, see gnl_rev_open()
+typedef struct s_gnl_rev	t_gnl_rev;
+
+// line offset index of a file, see gnl_index_build() / gnl_seek_line()
+typedef struct s_gnl_index	t_gnl_index;
+
+// field cursor over one line, see gnl_fields_init() / gnl_field_next()
+// p[0 .. len] is what is left of the line, done: no field left
+typedef struct s_gnl_fields
+{
+	const char	*p;
+	size_t		len;
+	char		sep;
+	char		quote;
+	int			done;
+}	t_gnl_fields;
+
+// gnl_ring_new() flag: skip io_uring, use the poll() + read() engine
+# define GNL_RING_POLL 1
+
+// reader options, all-zero (or a NULL pointer) means defaults
+// no_mmap: never serve this reader from an mmap() of the file
+// arena: gnl_next() lines come from this arena, they must not be free()d
+// read_size: size of the first read() (BUFFER_SIZE), grown x2 while reads
+//            come back full, up to read_max (1 MiB); ttys stay at read_size
+// prefetch: a helper thread keeps two read_max buffers filled ahead of
+//           the caller, so read() and line splitting overlap
+// delim: what ends a line ("\n"), delim_len bytes long (0: strlen(delim),
+//        "" being the '\0' byte), e.g. "\r\n", "" for find -print0, "\x1e"
+// strip: lines are handed out without their delimiter
+// max_line: longer lines come in fragments of max_line bytes (see
+//           gnl_next_chunk; the last one also gets the delimiter), a
+//           read() stash then stays O(max_line) in size (an mmap()-ed
+//           file is served in place anyway)
+typedef struct s_gnl_opts
+{
+	int			no_mmap;
+	t_gnl_arena	*arena;
+	size_t		read_size;
+	size_t		read_max;
+	int			prefetch;
+	const char	*delim;
+	size_t		delim_len;
+	int			strip;
+	size_t		max_line;
+}	t_gnl_opts;
+
+// per-reader counters, only collected when every get_next_line*.c file is
+// compiled with -D GNL_STATS=1 (see gnl_stats)
+// reads: read() calls (or read-ahead / ring buffers taken), bytes_read
+// bytes_copied: stash slides and growths, line copies
+// allocs: malloc() calls for the stash and the lines
+// lines: lines served, max_stash: most bytes held by the stash at once
+// blocked_ns: time spent waiting in read() (or on the read-ahead thread)
+typedef struct s_gnl_stats
+{
+	size_t	reads;
+	size_t	bytes_read;
+	size_t	bytes_copied;
+	size_t	allocs;
+	size_t	lines;
+	size_t	max_stash;
+	size_t	blocked_ns;
+}	t_gnl_stats;
+
+// gnl_parallel() callback, non zero return stops the calling worker
+typedef int					(*t_gnl_line_fn)(const char *line, size_t len,
+								int worker, void *ctx);
+
+char			*get_next_line(int fd);
+int				get_next_line_view(int fd, const char **line, size_t *len);
+ssize_t			gnl_getline(int fd, char **buf, size_t *cap);
+ssize_t			gnl_count_lines(int fd);
+void			gnl_close_fd(int fd);
+void			gnl_reset_all(void);
+void			gnl_idle_reclaim(size_t calls);
+
+t_gnl_reader	*gnl_open(int fd, const t_gnl_opts *opts);
+char			*gnl_next(t_gnl_reader *r);
+int				gnl_next_view(t_gnl_reader *r, const char **line, size_t *len);
+ssize_t			gnl_next_getline(t_gnl_reader *r, char **buf, size_t *cap);
+ssize_t			gnl_skip_lines(t_gnl_reader *r, size_t n);
+int				gnl_next_chunk(t_gnl_reader *r, const char **chunk,
+					size_t *len, int *more);
+char			*gnl_next_match(t_gnl_reader *r, const char *pattern);
+void			gnl_close(t_gnl_reader *r);
+t_gnl_reader	*gnl_open_src(const t_gnl_src *src, const t_gnl_opts *opts);
+t_gnl_reader	*gnl_open_mem(const char *buf, size_t len,
+					const t_gnl_opts *opts);
+
+void			gnl_fields_init(t_gnl_fields *f, const char *line, size_t len,
+					const char *sep_quote);
+int				gnl_field_next(t_gnl_fields *f, const char **field,
+					size_t *len);
+int				gnl_parse_long(const char *s, size_t len, long *out);
+int				gnl_parse_double(const char *s, size_t len, double *out);
+
+t_gnl_rev		*gnl_rev_open(int fd);
+char			*gnl_rev_next(t_gnl_rev *rv);
+void			gnl_rev_close(t_gnl_rev *rv);
+
+int				gnl_index_build(int fd, const char *path, size_t k,
+					int workers);
+t_gnl_index		*gnl_index_open(const char *path, int fd);
+size_t			gnl_index_lines(const t_gnl_index *idx);
+void			gnl_index_close(t_gnl_index *idx);
+int				gnl_seek_line(t_gnl_reader *r, const t_gnl_index *idx,
+					size_t n);
+
+t_gnl_arena		*gnl_arena_new(size_t slab);
+char			*gnl_arena_alloc(t_gnl_arena *a, size_t n);
+void			gnl_arena_reset(t_gnl_arena *a);
+void			gnl_arena_free(t_gnl_arena *a);
+
+t_gnl_ring		*gnl_ring_new(unsigned max, int flags);
+int				gnl_ring_add(t_gnl_ring *ring, int fd,
+					const t_gnl_opts *opts);
+void			gnl_ring_remove(t_gnl_ring *ring, int fd);
+char			*gnl_ring_next(t_gnl_ring *ring, int *fd);
+void			gnl_ring_free(t_gnl_ring *ring);
+
+t_gnl_mux		*gnl_mux_new(void);
+int				gnl_mux_add(t_gnl_mux *mux, int fd);
+void			gnl_mux_remove(t_gnl_mux *mux, int fd);
+char			*gnl_mux_next(t_gnl_mux *mux, int *fd, int timeout);
+void			gnl_mux_free(t_gnl_mux *mux);
+
+int				gnl_parallel(int fd, int workers, t_gnl_line_fn fn, void *ctx);
+
+int				gnl_stats(int fd, t_gnl_stats *out);
+int				gnl_reader_stats(t_gnl_reader *r, t_gnl_stats *out);
+void			gnl_stats_dump(void);
 
 #endif
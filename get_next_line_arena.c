@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_arena.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:46:28 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 06:46:28 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+
+// lines are bump-allocated from slabs of at least 'slab' bytes
+// (0: GNL_ARENA_SLAB), nothing is freed before gnl_arena_reset()
+t_gnl_arena	*gnl_arena_new(size_t slab)
+{
+	t_gnl_arena	*a;
+
+	a = calloc(1, sizeof(*a));
+	if (!a)
+		return (NULL);
+	a->slab = slab;
+	if (!a->slab)
+		a->slab = GNL_ARENA_SLAB;
+	return (a);
+}
+
+// next slab with room for n bytes: the following (already used) one
+// after a reset, or a new one put right after the current slab
+static t_gnl_slab	*gnl_arena_slab(t_gnl_arena *a, size_t n)
+{
+	t_gnl_slab	*s;
+	size_t		size;
+
+	if (a->cur && a->cur->next && a->cur->next->size >= n)
+		return (a->cur->next);
+	size = a->slab;
+	if (size < n)
+		size = n;
+	s = malloc(sizeof(*s) + size);
+	if (!s)
+		return (NULL);
+	s->size = size;
+	s->used = 0;
+	s->next = NULL;
+	if (!a->cur)
+		a->head = s;
+	else
+	{
+		s->next = a->cur->next;
+		a->cur->next = s;
+	}
+	return (s);
+}
+
+// n bytes out of the current slab, moving on to the next one when full
+char	*gnl_arena_alloc(t_gnl_arena *a, size_t n)
+{
+	t_gnl_slab	*s;
+	char		*p;
+
+	n = (n + 15) & ~(size_t)15;
+	s = a->cur;
+	if (!s || s->size - s->used < n)
+	{
+		s = gnl_arena_slab(a, n);
+		if (!s)
+			return (NULL);
+		a->cur = s;
+	}
+	p = s->data + s->used;
+	s->used += n;
+	return (p);
+}
+
+// drop every line handed out so far, in one go
+// the slabs are kept and reused, so a steady batch loop stops calling malloc
+void	gnl_arena_reset(t_gnl_arena *a)
+{
+	t_gnl_slab	*s;
+
+	if (!a)
+		return ;
+	s = a->head;
+	while (s)
+	{
+		s->used = 0;
+		s = s->next;
+	}
+	a->cur = a->head;
+}
+
+void	gnl_arena_free(t_gnl_arena *a)
+{
+	t_gnl_slab	*s;
+
+	if (!a)
+		return ;
+	while (a->head)
+	{
+		s = a->head->next;
+		free(a->head);
+		a->head = s;
+	}
+	free(a);
+}
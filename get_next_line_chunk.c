@@ -0,0 +1,32 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_chunk.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:16:42 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:18:28 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+
+// gnl_next_view() for readers with opts.max_line: a line longer than that
+// comes as several chunks of max_line bytes, *more is 1 on all of them but
+// the last one (*more 0: the chunk ends the line, delimiter included
+// unless opts.strip); without max_line every chunk is a whole line
+// a chunk is at most max_line bytes plus the delimiter: one that follows
+// max_line bytes still ends the line, even if read() splits it
+// returns 1 if a chunk was served, 0 on EOF, -1 on error, GNL_AGAIN
+int	gnl_next_chunk(t_gnl_reader *r, const char **chunk, size_t *len,
+		int *more)
+{
+	int	ret;
+
+	*more = 0;
+	ret = gnl_next_view(r, chunk, len);
+	if (ret == 1)
+		*more = r->cut;
+	return (ret);
+}
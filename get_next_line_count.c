@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_count.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:30:34 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:19:32 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+
+// exact per-byte match (the mask of gnl_swar_hit):
+// the high bit of a byte of ~(((x & 0x7f..) + 0x7f..) | x | 0x7f..) is
+// set iff that byte of x is 0, so the match count is its popcount
+size_t	gnl_memcount_swar(char *s, int c, size_t n)
+{
+	size_t	i;
+	size_t	count;
+	t_word	rep;
+	t_word	x;
+
+	i = 0;
+	count = 0;
+	while (i < n && ((unsigned long)(s + i) % sizeof(t_word)))
+		count += (s[i++] == (char)c);
+	rep = GNL_ONES * (unsigned char)c;
+	while (i + sizeof(t_word) <= n)
+	{
+		x = *(t_word *)(s + i) ^ rep;
+		x = ~(((x & (GNL_ONES * 0x7F)) + GNL_ONES * 0x7F) | x
+				| GNL_ONES * 0x7F);
+		count += __builtin_popcountl(x);
+		i += sizeof(t_word);
+	}
+	while (i < n)
+		count += (s[i++] == (char)c);
+	return (count);
+}
+
+// best counter this cpu can run, picked once via cpuid (see gnl_scan_pick)
+static t_count	gnl_count_pick(void)
+{
+	t_count	count;
+
+	count = gnl_memcount_swar;
+	if (GNL_X86)
+	{
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("sse2"))
+			count = gnl_memcount_sse2;
+		if (__builtin_cpu_supports("avx2"))
+			count = gnl_memcount_avx2;
+		if (__builtin_cpu_supports("avx512bw"))
+			count = gnl_memcount_avx512;
+	}
+	return (count);
+}
+
+// number of 'c' bytes in s[0 .. n]
+size_t	gnl_memcount(char *s, int c, size_t n)
+{
+	static t_count	count;
+	t_count			cur;
+
+	cur = __atomic_load_n(&count, __ATOMIC_RELAXED);
+	if (!cur)
+	{
+		cur = gnl_count_pick();
+		__atomic_store_n(&count, cur, __ATOMIC_RELAXED);
+	}
+	return (cur(s, c, n));
+}
@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_count_simd.c                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:30:34 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 07:30:34 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+
+// all three keep one byte counter per lane: a match compares to -1, so
+// subtracting the compare adds 1; every 255 steps (before a lane can
+// overflow) the lanes are summed up with sad (sum of absolute differences
+// against 0); the tail goes to the next smaller counter
+#if GNL_X86
+# include <immintrin.h>
+
+__attribute__((target("sse2")))
+size_t	gnl_memcount_sse2(char *s, int c, size_t n)
+{
+	size_t	i;
+	size_t	count;
+	int		k;
+	__m128i	rep;
+	__m128i	acc;
+
+	i = 0;
+	count = 0;
+	rep = _mm_set1_epi8((char)c);
+	while (i + 16 <= n)
+	{
+		acc = _mm_setzero_si128();
+		k = 0;
+		while (k++ < 255 && i + 16 <= n)
+		{
+			acc = _mm_sub_epi8(acc, _mm_cmpeq_epi8(
+						_mm_loadu_si128((__m128i *)(s + i)), rep));
+			i += 16;
+		}
+		acc = _mm_sad_epu8(acc, _mm_setzero_si128());
+		count += _mm_cvtsi128_si32(acc) + _mm_extract_epi16(acc, 4);
+	}
+	return (count + gnl_memcount_swar(s + i, c, n - i));
+}
+
+__attribute__((target("avx2")))
+size_t	gnl_memcount_avx2(char *s, int c, size_t n)
+{
+	size_t	i;
+	size_t	count;
+	int		k;
+	__m256i	rep;
+	__m256i	acc;
+
+	i = 0;
+	count = 0;
+	rep = _mm256_set1_epi8((char)c);
+	while (i + 32 <= n)
+	{
+		acc = _mm256_setzero_si256();
+		k = 0;
+		while (k++ < 255 && i + 32 <= n)
+		{
+			acc = _mm256_sub_epi8(acc, _mm256_cmpeq_epi8(
+						_mm256_loadu_si256((__m256i *)(s + i)), rep));
+			i += 32;
+		}
+		acc = _mm256_sad_epu8(acc, _mm256_setzero_si256());
+		count += _mm256_extract_epi64(acc, 0) + _mm256_extract_epi64(acc, 1)
+			+ _mm256_extract_epi64(acc, 2) + _mm256_extract_epi64(acc, 3);
+	}
+	return (count + gnl_memcount_sse2(s + i, c, n - i));
+}
+
+__attribute__((target("avx512f,avx512bw")))
+size_t	gnl_memcount_avx512(char *s, int c, size_t n)
+{
+	size_t	i;
+	size_t	count;
+	int		k;
+	__m512i	rep;
+	__m512i	acc;
+
+	i = 0;
+	count = 0;
+	rep = _mm512_set1_epi8((char)c);
+	while (i + 64 <= n)
+	{
+		acc = _mm512_setzero_si512();
+		k = 0;
+		while (k++ < 255 && i + 64 <= n)
+		{
+			acc = _mm512_sub_epi8(acc, _mm512_movm_epi8(_mm512_cmpeq_epi8_mask(
+							_mm512_loadu_si512(s + i), rep)));
+			i += 64;
+		}
+		count += _mm512_reduce_add_epi64(
+				_mm512_sad_epu8(acc, _mm512_setzero_si512()));
+	}
+	return (count + gnl_memcount_avx2(s + i, c, n - i));
+}
+
+#else
+
+size_t	gnl_memcount_sse2(char *s, int c, size_t n)
+{
+	return (gnl_memcount_swar(s, c, n));
+}
+
+size_t	gnl_memcount_avx2(char *s, int c, size_t n)
+{
+	return (gnl_memcount_swar(s, c, n));
+}
+
+size_t	gnl_memcount_avx512(char *s, int c, size_t n)
+{
+	return (gnl_memcount_swar(s, c, n));
+}
+
+#endif
@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_delim.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:04:05 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:18:28 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+
+// opts.delim / opts.delim_len, resolved once per reader:
+// NULL is "\n", delim_len 0 means strlen(delim) and "" is the '\0' byte
+void	gnl_delim_init(t_gnl_reader *r)
+{
+	r->delim = "\n";
+	r->dlen = 1;
+	if (!r->opts.delim)
+		return ;
+	r->delim = r->opts.delim;
+	r->dlen = r->opts.delim_len;
+	while (!r->opts.delim_len && r->delim[r->dlen])
+		r->dlen++;
+	if (!r->dlen)
+		r->dlen = 1;
+}
+
+// first pat[0 .. plen] in s[0 .. n] (plen > 0): vector scan for its first
+// byte, then compare the rest
+char	*gnl_memmem(char *s, size_t n, const char *pat, size_t plen)
+{
+	char	*hit;
+	size_t	i;
+
+	while (n >= plen)
+	{
+		hit = gnl_memchr(s, pat[0], n - plen + 1);
+		if (!hit)
+			return (NULL);
+		i = 1;
+		while (i < plen && hit[i] == pat[i])
+			i++;
+		if (i == plen)
+			return (hit);
+		n -= hit + 1 - s;
+		s = hit + 1;
+	}
+	return (NULL);
+}
+
+// first delimiter in s[0 .. n]
+// one byte: the vector scanner as is (the byte only sets a broadcast
+// register, any delimiter runs exactly like '\n')
+// longer: see gnl_memmem
+static char	*gnl_delim(t_gnl_reader *r, char *s, size_t n)
+{
+	if (r->dlen == 1)
+		return (gnl_memchr(s, r->delim[0], n));
+	return (gnl_memmem(s, n, r->delim, r->dlen));
+}
+
+// length of the first complete line in the stash (delimiter included),
+// 0 if there is none yet
+// only the bytes appended since the last scan are searched; the last
+// dlen - 1 of them are searched again, a delimiter may straddle a read
+// with opts.max_line, only max_line + dlen bytes are searched (a delimiter
+// right after max_line bytes still ends the line): once they hold no
+// delimiter, their first max_line are the next fragment of a longer line
+// (r->cut is set)
+size_t	gnl_find(t_gnl_reader *r)
+{
+	t_stash	*st;
+	char	*hit;
+	size_t	end;
+
+	if (!r->dlen)
+		gnl_delim_init(r);
+	st = &r->st;
+	end = st->len;
+	if (r->opts.max_line && end - st->off > r->opts.max_line + r->dlen)
+		end = st->off + r->opts.max_line + r->dlen;
+	hit = NULL;
+	if (end > st->off + st->scan)
+		hit = gnl_delim(r, st->buf + st->off + st->scan,
+				end - st->off - st->scan);
+	r->cut = (!hit && r->opts.max_line
+			&& end - st->off == r->opts.max_line + r->dlen);
+	if (hit)
+		return (hit - (st->buf + st->off) + r->dlen);
+	if (r->cut)
+		return (r->opts.max_line);
+	st->scan = 0;
+	if (st->len - st->off >= r->dlen - 1)
+		st->scan = st->len - st->off - (r->dlen - 1);
+	return (0);
+}
+
+// how much of the next n stash bytes the caller gets: all of them, or
+// without the trailing delimiter with opts.strip
+size_t	gnl_keep(t_gnl_reader *r, size_t n)
+{
+	size_t	i;
+	char	*end;
+
+	if (!r->opts.strip || n < r->dlen)
+		return (n);
+	end = r->st.buf + r->st.off + n - r->dlen;
+	i = 0;
+	while (i < r->dlen && end[i] == r->delim[i])
+		i++;
+	if (i == r->dlen)
+		return (n - r->dlen);
+	return (n);
+}
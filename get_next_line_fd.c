@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_fd.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:40:08 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:56:22 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+#include <fcntl.h>
+
+// grow the page directory (x2) so that it covers page index 'page'
+static int	gnl_fdtab_grow(t_fdtab *tab, size_t page)
+{
+	size_t			n;
+	t_gnl_reader	**new;
+
+	n = tab->npages * 2;
+	if (n <= page)
+		n = page + 1;
+	new = calloc(n, sizeof(*new));
+	if (!new)
+		return (0);
+	if (tab->npages)
+		gnl_memcpy((char *)new, (char *)tab->pages,
+			tab->npages * sizeof(*new));
+	free(tab->pages);
+	tab->pages = new;
+	tab->npages = n;
+	return (1);
+}
+
+// the one fd table of the process
+t_fdtab	*gnl_fdtab(void)
+{
+	static t_fdtab	tab;
+
+	return (&tab);
+}
+
+// fd -> reader table: a directory of GNL_FD_PAGE sized reader pages,
+// a page is only allocated once one of its fds is used, and only for an
+// open fd (EBADF otherwise): a stray fd number never grows the directory
+// the reader of fd keeps whatever was read from it, but not yet returned
+// with GNL_STATS, the first call also sets up the gnl_stats_dump() at exit
+// every call is one tick of the idle reclaim clock (see gnl_idle_reclaim)
+t_gnl_reader	*gnl_fd_reader(int fd)
+{
+	t_fdtab	*tab;
+	size_t	page;
+
+	if (fd < 0 || BUFFER_SIZE <= 0)
+		return (NULL);
+	tab = gnl_fdtab();
+	if (GNL_STATS && !tab->dump)
+		tab->dump = !atexit(gnl_stats_dump);
+	page = (size_t)fd / GNL_FD_PAGE;
+	if ((page >= tab->npages || !tab->pages[page])
+		&& fcntl(fd, F_GETFD) < 0)
+		return (NULL);
+	if (page >= tab->npages && !gnl_fdtab_grow(tab, page))
+		return (NULL);
+	if (!tab->pages[page])
+		tab->pages[page] = calloc(GNL_FD_PAGE, sizeof(t_gnl_reader));
+	if (!tab->pages[page])
+		return (NULL);
+	tab->pages[page][fd % GNL_FD_PAGE].fd = fd;
+	tab->pages[page][fd % GNL_FD_PAGE].tick = ++tab->tick;
+	tab->pages[page][fd % GNL_FD_PAGE].view = 0;
+	if (tab->idle && tab->tick % tab->idle == 0)
+		gnl_fd_sweep(tab);
+	return (&tab->pages[page][fd % GNL_FD_PAGE]);
+}
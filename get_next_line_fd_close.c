@@ -0,0 +1,62 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_fd_close.c                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:14:59 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 07:14:59 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+
+// back to a never used reader: stash, read size and delimiter are dropped
+// (the stats, if any, are kept)
+void	gnl_fd_reset(t_gnl_reader *r)
+{
+	gnl_prefetch_stop(r);
+	gnl_free(&r->st);
+	r->rsize = 0;
+	r->rmax = 0;
+	r->delim = NULL;
+	r->dlen = 0;
+}
+
+// forget whatever get_next_line() has buffered for fd, e.g. before closing
+// it: a later open() that gets the same fd number starts from a clean slate
+// (readers from gnl_open() are not affected, use gnl_close() on those)
+void	gnl_close_fd(int fd)
+{
+	t_fdtab	*tab;
+	size_t	page;
+
+	tab = gnl_fdtab();
+	page = (size_t)fd / GNL_FD_PAGE;
+	if (fd < 0 || page >= tab->npages || !tab->pages[page])
+		return ;
+	gnl_fd_reset(&tab->pages[page][fd % GNL_FD_PAGE]);
+}
+
+// gnl_close_fd() on every fd, then free the fd table itself
+void	gnl_reset_all(void)
+{
+	t_fdtab	*tab;
+	size_t	page;
+	size_t	i;
+
+	tab = gnl_fdtab();
+	page = 0;
+	while (page < tab->npages)
+	{
+		i = 0;
+		while (tab->pages[page] && i < GNL_FD_PAGE)
+			gnl_fd_reset(&tab->pages[page][i++]);
+		free(tab->pages[page++]);
+	}
+	free(tab->pages);
+	tab->pages = NULL;
+	tab->npages = 0;
+	tab->tick = 0;
+}
@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_fields.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:40:07 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 07:44:00 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+
+// cursor over the fields of line[0 .. len] (a view from gnl_next_view() or
+// gnl_next_chunk(), its trailing "\n" or "\r\n" is left out)
+// sep_quote: the separator, then optionally the quote character,
+// e.g. "," ",\"" "\t" " "
+void	gnl_fields_init(t_gnl_fields *f, const char *line, size_t len,
+		const char *sep_quote)
+{
+	if (len && line[len - 1] == '\n')
+		len--;
+	if (len && line[len - 1] == '\r')
+		len--;
+	f->p = line;
+	f->len = len;
+	f->sep = sep_quote[0];
+	f->quote = 0;
+	if (f->sep)
+		f->quote = sep_quote[1];
+	f->done = 0;
+}
+
+// step past the separator at s (or to the end if s is NULL: last field)
+static void	gnl_field_skip(t_gnl_fields *f, const char *s)
+{
+	if (!s)
+	{
+		f->p += f->len;
+		f->len = 0;
+		f->done = 1;
+		return ;
+	}
+	f->len -= s + 1 - f->p;
+	f->p = s + 1;
+}
+
+// "quoted field": up to the closing quote that is not a doubled one;
+// whatever follows it up to the separator is dropped
+static int	gnl_field_quoted(t_gnl_fields *f, const char **field,
+		size_t *len)
+{
+	const char	*end;
+	const char	*q;
+
+	end = f->p + f->len;
+	q = f->p;
+	while (1)
+	{
+		q = gnl_memchr((char *)q + 1, f->quote, end - q - 1);
+		if (!q || q + 1 == end || q[1] != f->quote)
+			break ;
+		q++;
+	}
+	if (!q)
+		q = end;
+	*field = f->p + 1;
+	*len = q - *field;
+	f->len = end - q;
+	f->p = q;
+	gnl_field_skip(f, gnl_memchr((char *)q, f->sep, f->len));
+	return (1);
+}
+
+// next field as a slice of the line: *field points into it, *len bytes
+// (no copy, no '\0'); "a,,b" has an empty middle field, "" one empty field
+// a quoted field comes without its quotes, doubled quotes inside it are
+// left as they are; returns 1 if a field was found, 0 after the last one
+int	gnl_field_next(t_gnl_fields *f, const char **field, size_t *len)
+{
+	const char	*s;
+
+	*field = NULL;
+	*len = 0;
+	if (f->done)
+		return (0);
+	if (f->quote && f->len && f->p[0] == f->quote)
+		return (gnl_field_quoted(f, field, len));
+	s = gnl_memchr((char *)f->p, f->sep, f->len);
+	*field = f->p;
+	*len = f->len;
+	if (s)
+		*len = s - f->p;
+	gnl_field_skip(f, s);
+	return (1);
+}
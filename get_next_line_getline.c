@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_getline.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:20:40 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:54:01 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+#include <errno.h>
+
+// (re)allocate *buf for at least len + 1 bytes, x2 its capacity
+// *cap is 0 if that fails
+static int	gnl_line_grow(char **buf, size_t *cap, size_t len)
+{
+	size_t	size;
+
+	size = *cap * 2;
+	if (size < len + 1)
+		size = len + 1;
+	free(*buf);
+	*buf = malloc(size);
+	*cap = 0;
+	if (!*buf)
+		return (0);
+	*cap = size;
+	return (1);
+}
+
+// getline()-style variant: the line is copied into the caller's *buf,
+// which is (re)allocated only when the line does not fit in *cap bytes
+// returns the line length (binary-safe), -1 on EOF (errno 0) or error,
+// GNL_AGAIN
+ssize_t	gnl_next_getline(t_gnl_reader *r, char **buf, size_t *cap)
+{
+	const char	*line;
+	size_t		len;
+	int			ret;
+
+	ret = gnl_next_view(r, &line, &len);
+	if (ret == GNL_AGAIN)
+		return (GNL_AGAIN);
+	if (ret == 0)
+		errno = 0;
+	if (ret != 1)
+		return (-1);
+	if (!*buf || *cap < len + 1)
+	{
+		GNL_STAT(&r->st, allocs, 1);
+		if (!gnl_line_grow(buf, cap, len))
+			return (-1);
+	}
+	gnl_memcpy(*buf, (char *)line, len);
+	GNL_STAT(&r->st, bytes_copied, len);
+	(*buf)[len] = '\0';
+	return (len);
+}
@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_idle.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:15:00 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:55:33 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+
+// idle reclaim: every 'calls' get_next_line*() calls, each fd that was not
+// read during the last 'calls' calls and holds no unread bytes is torn
+// down as by gnl_close_fd(), its buffers (or mapping) are given back
+// unread bytes are never dropped implicitly: an fd with some left in its
+// stash, mapping or read-ahead buffers is left alone, and so is an fd whose
+// last call was get_next_line_view() (its view stays valid)
+// 0 turns it off (the default)
+void	gnl_idle_reclaim(size_t calls)
+{
+	gnl_fdtab()->idle = calls;
+}
+
+// 1 if r holds buffers but no unread byte; a read-ahead thread must have
+// stopped, or be parked on an EAGAIN, on the buffer the reader takes next
+static int	gnl_fd_idle(t_gnl_reader *r)
+{
+	t_gnl_prefetch	*pf;
+
+	if ((!r->st.buf && !r->pf) || r->view || r->st.off < r->st.len)
+		return (0);
+	pf = r->pf;
+	if (!pf)
+		return (1);
+	return (__atomic_load_n(&pf->state[pf->slot], __ATOMIC_ACQUIRE)
+		== GNL_PF_FULL && pf->len[pf->slot] <= 0);
+}
+
+// one reclaim pass over the allocated pages (never used readers skipped)
+void	gnl_fd_sweep(t_fdtab *tab)
+{
+	t_gnl_reader	*r;
+	size_t			page;
+	size_t			i;
+
+	page = 0;
+	while (page < tab->npages)
+	{
+		i = 0;
+		while (tab->pages[page] && i < GNL_FD_PAGE)
+		{
+			r = &tab->pages[page][i++];
+			if (tab->tick - r->tick >= tab->idle && gnl_fd_idle(r))
+				gnl_fd_reset(r);
+		}
+		page++;
+	}
+}
@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_index.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:25:50 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:02:23 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// one worker, one pass over its slice, line by line (see t_gnl_idx_job)
+static void	*gnl_idx_walk(void *arg)
+{
+	t_gnl_idx_job	*job;
+	size_t			pos;
+	size_t			line;
+	char			*nl;
+
+	job = arg;
+	pos = job->lo;
+	line = job->first;
+	while (pos < job->hi)
+	{
+		if (job->out && line % job->k == 0)
+			job->out[line / job->k] = pos;
+		nl = gnl_memchr(job->map + pos, '\n', job->hi - pos);
+		pos = job->hi;
+		if (nl)
+			pos = nl - job->map + 1;
+		line++;
+	}
+	job->lines = line - job->first;
+	return (NULL);
+}
+
+// one pass of all n workers at once (out: see t_gnl_idx_job), then the
+// line number each one starts at
+static void	gnl_idx_run(t_gnl_idx_job *job, int n, uint64_t *out)
+{
+	int	i;
+
+	i = -1;
+	while (++i < n)
+	{
+		job[i].out = out;
+		job[i].started = !pthread_create(&job[i].tid, NULL, gnl_idx_walk,
+				&job[i]);
+		if (!job[i].started)
+			gnl_idx_walk(&job[i]);
+	}
+	while (--i >= 0)
+		if (job[i].started)
+			pthread_join(job[i].tid, NULL);
+	while (++i < n - 1)
+		job[i + 1].first = job[i].first + job[i].lines;
+}
+
+// both passes over map[0 .. size] cut in n slices: count the lines of each
+// slice, then sample them; h gets the totals, returns the samples (malloc'd)
+static uint64_t	*gnl_idx_jobs(char *map, t_gnl_idx_hdr *h, int n)
+{
+	t_gnl_idx_job	*job;
+	uint64_t		*out;
+	int				i;
+
+	job = calloc(n, sizeof(*job));
+	if (!job)
+		return (NULL);
+	i = -1;
+	while (++i < n)
+	{
+		job[i].map = map;
+		job[i].lo = gnl_slice_start(map, h->size, i, n);
+		job[i].hi = gnl_slice_start(map, h->size, i + 1, n);
+		job[i].k = h->k;
+	}
+	gnl_idx_run(job, n, NULL);
+	h->lines = job[n - 1].first + job[n - 1].lines;
+	h->samples = (h->lines + h->k - 1) / h->k;
+	out = malloc(h->samples * sizeof(*out) + 1);
+	if (out)
+		gnl_idx_run(job, n, out);
+	free(job);
+	return (out);
+}
+
+static void	gnl_idx_hdr(t_gnl_idx_hdr *h, size_t k, const struct stat *sb)
+{
+	gnl_bzero(h, sizeof(*h));
+	gnl_memcpy(h->magic, GNL_IDX_MAGIC, sizeof(h->magic));
+	h->k = k;
+	if (!k)
+		h->k = GNL_IDX_K;
+	h->size = sb->st_size;
+	h->mtime = (uint64_t)sb->st_mtim.tv_sec * 1000000000
+		+ sb->st_mtim.tv_nsec;
+}
+
+// scan the regular file fd once, 'workers' threads in parallel (<= 0: one
+// per online cpu), and write the index of its lines to path: the offset
+// of every k-th line (k 0: GNL_IDX_K), delta encoded (see t_gnl_idx_hdr)
+// lines are '\n' terminated, as get_next_line() cuts them by default
+// returns 0, or -1 (errno EOVERFLOW: k * GNL_IDX_GROUP lines span more
+// than 4 GiB, take a smaller k); a failed build leaves path untouched
+int	gnl_index_build(int fd, const char *path, size_t k, int workers)
+{
+	t_gnl_idx_hdr	h;
+	struct stat		sb;
+	char			*map;
+	uint64_t		*out;
+	int				ret;
+
+	if (workers <= 0)
+		workers = sysconf(_SC_NPROCESSORS_ONLN);
+	if (workers <= 0 || fstat(fd, &sb) < 0 || !S_ISREG(sb.st_mode))
+		return (-1);
+	gnl_idx_hdr(&h, k, &sb);
+	map = NULL;
+	if (sb.st_size)
+		map = mmap(NULL, sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (map == MAP_FAILED)
+		return (-1);
+	out = gnl_idx_jobs(map, &h, workers);
+	if (map)
+		munmap(map, sb.st_size);
+	ret = -1;
+	if (out)
+		ret = gnl_idx_write(path, &h, out);
+	free(out);
+	return (ret);
+}
@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_index_file.c                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:26:08 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:02:23 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// a 64-bit FNV-1a over the whole index file that starts at h, with
+// h->sum taken as 0; word by word (the file is a multiple of 4 bytes)
+uint64_t	gnl_idx_sum(const t_gnl_idx_hdr *h)
+{
+	t_gnl_idx_hdr	copy;
+	const uint32_t	*p;
+	size_t			len;
+	size_t			i;
+	uint64_t		sum;
+
+	copy = *h;
+	copy.sum = 0;
+	len = (h->samples + GNL_IDX_GROUP - 1) / GNL_IDX_GROUP
+		* sizeof(uint64_t) + h->samples * sizeof(uint32_t);
+	sum = 0xcbf29ce484222325ULL;
+	p = (const uint32_t *)&copy;
+	i = 0;
+	while (i < sizeof(copy) / sizeof(*p))
+		sum = (sum ^ p[i++]) * 0x100000001b3ULL;
+	p = (const uint32_t *)(h + 1);
+	i = 0;
+	while (i < len / sizeof(*p))
+		sum = (sum ^ p[i++]) * 0x100000001b3ULL;
+	return (sum);
+}
+
+// group bases and deltas of the samples out[] into the file at dst, then
+// its header (with its checksum) last
+// -1 if a sample lies more than 4 GiB past the base of its group
+static int	gnl_idx_encode(t_gnl_idx_hdr *dst, t_gnl_idx_hdr *h, uint64_t *out)
+{
+	uint64_t	*base;
+	uint32_t	*delta;
+	size_t		i;
+
+	base = (uint64_t *)(dst + 1);
+	delta = (uint32_t *)(base
+			+ (h->samples + GNL_IDX_GROUP - 1) / GNL_IDX_GROUP);
+	i = 0;
+	while (i < h->samples)
+	{
+		if (i % GNL_IDX_GROUP == 0)
+			base[i / GNL_IDX_GROUP] = out[i];
+		if (out[i] - base[i / GNL_IDX_GROUP] > UINT32_MAX)
+		{
+			errno = EOVERFLOW;
+			return (-1);
+		}
+		delta[i] = out[i] - base[i / GNL_IDX_GROUP];
+		i++;
+	}
+	*dst = *h;
+	dst->sum = gnl_idx_sum(dst);
+	return (0);
+}
+
+// the whole index into the (new, empty) file fd, through a shared mapping
+// of it, then to disk
+static int	gnl_idx_fill(int fd, t_gnl_idx_hdr *h, uint64_t *out)
+{
+	size_t	len;
+	void	*map;
+	int		ret;
+
+	len = sizeof(*h) + (h->samples + GNL_IDX_GROUP - 1) / GNL_IDX_GROUP
+		* sizeof(uint64_t) + h->samples * sizeof(uint32_t);
+	if (ftruncate(fd, len) < 0)
+		return (-1);
+	map = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (map == MAP_FAILED)
+		return (-1);
+	ret = gnl_idx_encode(map, h, out);
+	munmap(map, len);
+	if (ret == 0)
+		ret = fsync(fd);
+	return (ret);
+}
+
+// path.tmp, malloc'd
+static char	*gnl_idx_tmp(const char *path)
+{
+	char	*tmp;
+	size_t	len;
+
+	len = 0;
+	while (path[len])
+		len++;
+	tmp = malloc(len + 5);
+	if (!tmp)
+		return (NULL);
+	gnl_memcpy(tmp, (char *)path, len);
+	gnl_memcpy(tmp + len, ".tmp", 5);
+	return (tmp);
+}
+
+// write the index of h and the samples out[] to path (the file is then
+// exactly what gnl_index_open() maps); it is built as path.tmp and only
+// renamed over path once complete: on error, path is left as it was
+int	gnl_idx_write(const char *path, t_gnl_idx_hdr *h, uint64_t *out)
+{
+	char	*tmp;
+	int		fd;
+	int		ret;
+	int		err;
+
+	tmp = gnl_idx_tmp(path);
+	if (!tmp)
+		return (-1);
+	ret = -1;
+	fd = open(tmp, O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (fd >= 0)
+		ret = gnl_idx_fill(fd, h, out);
+	if (fd >= 0 && close(fd) < 0)
+		ret = -1;
+	if (ret == 0)
+		ret = rename(tmp, path);
+	err = errno;
+	if (ret < 0 && fd >= 0)
+		unlink(tmp);
+	free(tmp);
+	errno = err;
+	return (ret);
+}
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_index_open.c                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 08:53:18 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 08:53:18 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// the file fd is still the one h was built from: same size and mtime
+int	gnl_idx_fresh(const t_gnl_idx_hdr *h, int fd)
+{
+	struct stat	sb;
+
+	if (fstat(fd, &sb) < 0)
+		return (0);
+	return ((uint64_t)sb.st_size == h->size
+		&& (uint64_t)sb.st_mtim.tv_sec * 1000000000
+		+ sb.st_mtim.tv_nsec == h->mtime);
+}
+
+// magic, k, the file length and the checksum all agree with the header
+static int	gnl_idx_valid(t_gnl_idx_hdr *h, size_t len)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < sizeof(h->magic) && h->magic[i] == GNL_IDX_MAGIC[i])
+		i++;
+	return (i == sizeof(h->magic) && h->k
+		&& len == sizeof(*h) + (h->samples + GNL_IDX_GROUP - 1)
+		/ GNL_IDX_GROUP * sizeof(uint64_t) + h->samples * sizeof(uint32_t)
+		&& gnl_idx_sum(h) == h->sum);
+}
+
+// the file at path, mapped read-only and shared (*len bytes), if it is at
+// least a header long; MAP_FAILED otherwise
+static t_gnl_idx_hdr	*gnl_idx_map(const char *path, size_t *len)
+{
+	struct stat		sb;
+	t_gnl_idx_hdr	*h;
+	int				fd;
+
+	fd = open(path, O_RDONLY);
+	h = MAP_FAILED;
+	if (fd >= 0 && fstat(fd, &sb) == 0 && sb.st_size >= (off_t)sizeof(*h))
+		h = mmap(NULL, sb.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	if (fd >= 0)
+		close(fd);
+	*len = 0;
+	if (h != MAP_FAILED)
+		*len = sb.st_size;
+	return (h);
+}
+
+// map an index written by gnl_index_build(), read-only and shared, so any
+// number of processes can use the same file
+// fd: the indexed file, the index must still match it (size and mtime),
+// -1 to skip that check (e.g. for a memory reader over a copy of it)
+// NULL if path is not a complete index, or a stale one: build it again
+t_gnl_index	*gnl_index_open(const char *path, int fd)
+{
+	t_gnl_index		*idx;
+	t_gnl_idx_hdr	*h;
+	size_t			len;
+
+	h = gnl_idx_map(path, &len);
+	if (h == MAP_FAILED)
+		return (NULL);
+	idx = malloc(sizeof(*idx));
+	if (!idx || !gnl_idx_valid(h, len) || (fd >= 0 && !gnl_idx_fresh(h, fd)))
+	{
+		free(idx);
+		munmap(h, len);
+		return (NULL);
+	}
+	idx->hdr = h;
+	idx->len = len;
+	idx->base = (uint64_t *)(h + 1);
+	idx->delta = (uint32_t *)(idx->base
+			+ (h->samples + GNL_IDX_GROUP - 1) / GNL_IDX_GROUP);
+	return (idx);
+}
+
+void	gnl_index_close(t_gnl_index *idx)
+{
+	if (!idx)
+		return ;
+	munmap(idx->hdr, idx->len);
+	free(idx);
+}
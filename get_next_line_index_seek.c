@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_index_seek.c                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:26:35 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:02:23 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+
+// number of lines of the indexed file
+size_t	gnl_index_lines(const t_gnl_index *idx)
+{
+	return (idx->hdr->lines);
+}
+
+// move the reader to byte off of its file: a memory reader just moves its
+// stash offset, an fd reader drops its stash and lseek()s
+// -1 if the reader is not over the file idx was built from (size differs,
+// or, for an fd, its mtime)
+static int	gnl_seek_to(t_gnl_reader *r, const t_gnl_index *idx, size_t off)
+{
+	if (r->st.mem && r->st.len == idx->hdr->size)
+	{
+		r->st.off = off;
+		r->st.scan = 0;
+		return (0);
+	}
+	if (r->st.mem || r->fd < 0 || !gnl_idx_fresh(idx->hdr, r->fd))
+		return (-1);
+	gnl_fd_reset(r);
+	if (lseek(r->fd, off, SEEK_SET) < 0)
+		return (-1);
+	return (0);
+}
+
+// position r so that its next line is line n (the first line being 0):
+// jump to the closest indexed line before it, then skip the few lines
+// (less than k) that are left; r must cut lines at '\n', without max_line
+// returns 0, or -1 if n is past the end, or idx is not r's file's index
+int	gnl_seek_line(t_gnl_reader *r, const t_gnl_index *idx, size_t n)
+{
+	size_t		i;
+	const char	*line;
+	size_t		len;
+
+	if (!r || !idx || n >= idx->hdr->lines)
+		return (-1);
+	i = n / idx->hdr->k;
+	if (gnl_seek_to(r, idx, idx->base[i / GNL_IDX_GROUP] + idx->delta[i]) < 0)
+		return (-1);
+	i = n % idx->hdr->k;
+	while (i--)
+		if (gnl_next_view(r, &line, &len) != 1)
+			return (-1);
+	return (0);
+}
@@ -0,0 +1,415 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_int.h                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:40:40 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:54:01 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef GET_NEXT_LINE_INT_H
+# define GET_NEXT_LINE_INT_H
+
+# include "get_next_line.h"
+# include <poll.h>
+# include <pthread.h>
+# include <sched.h>
+# include <stdint.h>
+
+# ifdef __linux__
+#  include <linux/futex.h>
+#  include <sys/syscall.h>
+#  define GNL_FUTEX_WAIT(a, v) \
+	syscall(SYS_futex, a, FUTEX_WAIT_PRIVATE, v, NULL, NULL, 0)
+#  define GNL_FUTEX_WAKE(a) \
+	syscall(SYS_futex, a, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0)
+# else
+#  define GNL_FUTEX_WAIT(a, v) sched_yield()
+#  define GNL_FUTEX_WAKE(a) 0
+# endif
+
+# ifndef GNL_FD_PAGE
+#  define GNL_FD_PAGE 256
+# endif
+
+# ifndef GNL_MMAP
+#  define GNL_MMAP 1
+# endif
+
+# ifndef GNL_MMAP_MIN
+#  define GNL_MMAP_MIN 65536
+# endif
+
+# ifndef GNL_READ_MAX
+#  define GNL_READ_MAX 1048576
+# endif
+
+# ifndef GNL_RING_BUF
+#  define GNL_RING_BUF 16384
+# endif
+
+# ifndef GNL_MUX_EVENTS
+#  define GNL_MUX_EVENTS 256
+# endif
+
+# ifndef GNL_ARENA_SLAB
+#  define GNL_ARENA_SLAB 1048576
+# endif
+
+# ifndef GNL_REV_BLOCK
+#  define GNL_REV_BLOCK 65536
+# endif
+
+# ifndef GNL_IDX_K
+#  define GNL_IDX_K 1024
+# endif
+
+# define GNL_IDX_MAGIC "GNLIDX2"
+# define GNL_IDX_GROUP 16
+
+# ifndef GNL_COUNT_BLOCK
+#  define GNL_COUNT_BLOCK 65536
+# endif
+
+# ifndef GNL_STATS
+#  define GNL_STATS 0
+# endif
+
+// GNL_STAT(st, field, n): st->stats.field += n, compiled out (n is not even
+// evaluated) without GNL_STATS; GNL_STAT_MAX(st, field, n): raise it to n
+// GNL_READ(r, buf, n): gnl_src_read() on the source of reader r, GNL_WAIT:
+// gnl_wait(); both also count and time themselves into the stash stats
+# if GNL_STATS
+#  define GNL_STAT(st, f, n) ((st)->stats.f += (n))
+#  define GNL_STAT_MAX(st, f, n) \
+	((void)((st)->stats.f < (n) && ((st)->stats.f = (n))))
+#  define GNL_READ(r, buf, n) gnl_stat_read(r, buf, n)
+#  define GNL_WAIT(st, addr, val) gnl_stat_wait(st, addr, val)
+# else
+#  define GNL_STAT(st, f, n) ((void)0)
+#  define GNL_STAT_MAX(st, f, n) ((void)0)
+#  define GNL_READ(r, buf, n) gnl_src_read(&(r)->src, (r)->fd, buf, n)
+#  define GNL_WAIT(st, addr, val) gnl_wait(addr, val)
+# endif
+
+# if defined(__x86_64__) || defined(__i386__)
+#  define GNL_X86 1
+# else
+#  define GNL_X86 0
+# endif
+
+# define GNL_LITTLE_ENDIAN (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+# define GNL_ONES ((t_word)-1 / 0xFF)
+
+// stash: buf[off .. len] is read but not yet returned to the caller
+// buf[off .. off + scan] is already known to contain no '\n'
+// map != 0: buf is a read-only mmap() of map bytes, not a malloc'd buffer
+// mem: buf is borrowed from the caller, never read into nor freed
+// stats: see GNL_STAT, outlives gnl_free()
+typedef struct s_stash
+{
+	char		*buf;
+	size_t		len;
+	size_t		cap;
+	size_t		off;
+	size_t		scan;
+	size_t		map;
+	int			mem;
+# if GNL_STATS
+	t_gnl_stats	stats;
+# endif
+}	t_stash;
+
+# define GNL_PF_EMPTY 0
+# define GNL_PF_FULL 1
+
+// read-ahead thread state (opts.prefetch): two buffers of size bytes that
+// the producer fills and the consumer drains in turn, state[i] is the
+// lock-free handoff (GNL_PF_EMPTY / GNL_PF_FULL) of buf[i]
+// len[i] is the producer's read() result (err[i] its errno, 0 if it did
+// not fail), slot the consumer's next buffer
+typedef struct s_gnl_prefetch
+{
+	pthread_t	tid;
+	int			fd;
+	t_gnl_src	src;
+	size_t		size;
+	char		*buf[2];
+	ssize_t		len[2];
+	int			err[2];
+	int			state[2];
+	int			slot;
+	int			stop;
+}	t_gnl_prefetch;
+
+// rsize: size of the next read(), grows up to rmax (see gnl_read_init)
+// delim: the dlen bytes that end a line (dlen 0: not resolved yet)
+// src: where the bytes come from when src.read is set, read(fd) otherwise
+// tick: fd table clock at the last get_next_line() on it (idle reclaim)
+// cut: the line gnl_find() found last is only a fragment (opts.max_line)
+// view: the last get_next_line_view() on it handed out a view of the stash
+struct s_gnl_reader
+{
+	int				fd;
+	t_gnl_opts		opts;
+	t_stash			st;
+	size_t			rsize;
+	size_t			rmax;
+	t_gnl_prefetch	*pf;
+	t_gnl_src		src;
+	const char		*delim;
+	size_t			dlen;
+	size_t			tick;
+	int				cut;
+	int				view;
+};
+
+// sparse fd -> reader table: pages[fd / GNL_FD_PAGE][fd % GNL_FD_PAGE]
+// backs the plain get_next_line(fd) calls
+// tick: number of gnl_fd_reader() calls, idle: reclaim period (0: never)
+// dump: gnl_stats_dump() is registered
+typedef struct s_fdtab
+{
+	t_gnl_reader	**pages;
+	size_t			npages;
+	size_t			tick;
+	size_t			idle;
+	int				dump;
+}	t_fdtab;
+
+// arena slab: data[0 .. used] is handed out, data[used .. size] is free
+typedef struct s_gnl_slab
+{
+	struct s_gnl_slab	*next;
+	size_t				size;
+	size_t				used;
+	char				data[];
+}	t_gnl_slab;
+
+// slabs are kept in order, cur is the one being bumped
+struct s_gnl_arena
+{
+	t_gnl_slab	*head;
+	t_gnl_slab	*cur;
+	size_t		slab;
+};
+
+// reverse reader: buf[lo .. lo + len] holds the file bytes [pos, pos + len)
+// that precede everything served so far (from the file end backwards)
+// seen: that many bytes before the last one are known to hold no '\n'
+struct s_gnl_rev
+{
+	int		fd;
+	char	*buf;
+	size_t	cap;
+	size_t	lo;
+	size_t	len;
+	off_t	pos;
+	size_t	seen;
+};
+
+// line index sidecar (see gnl_index_build), mmap()-able as is:
+// this header, then base[(samples + GNL_IDX_GROUP - 1) / GNL_IDX_GROUP]
+// (uint64_t), then delta[samples] (uint32_t)
+// line i * k starts at byte base[i / GNL_IDX_GROUP] + delta[i] of the file
+// size, mtime (ns): of the indexed file, to tell a stale index
+// sum: gnl_idx_sum() of the whole file, this field taken as 0
+typedef struct s_gnl_idx_hdr
+{
+	char		magic[8];
+	uint64_t	k;
+	uint64_t	lines;
+	uint64_t	size;
+	uint64_t	mtime;
+	uint64_t	samples;
+	uint64_t	sum;
+}	t_gnl_idx_hdr;
+
+// an index file mapped by gnl_index_open(), len bytes
+struct s_gnl_index
+{
+	t_gnl_idx_hdr	*hdr;
+	uint64_t		*base;
+	uint32_t		*delta;
+	size_t			len;
+};
+
+// one index builder worker over the line-aligned map[lo .. hi]:
+// counts its lines (out NULL), or stores the offset of every line whose
+// number (first + its rank in the slice) is a multiple of k in out
+typedef struct s_gnl_idx_job
+{
+	char		*map;
+	size_t		lo;
+	size_t		hi;
+	size_t		first;
+	size_t		lines;
+	size_t		k;
+	uint64_t	*out;
+	pthread_t	tid;
+	int			started;
+}	t_gnl_idx_job;
+
+// one gnl_parallel() worker: the lines of buf[0 .. len] go to fn()
+typedef struct s_gnl_job
+{
+	char			*buf;
+	size_t			len;
+	int				worker;
+	t_gnl_line_fn	fn;
+	void			*ctx;
+	pthread_t		tid;
+	int				started;
+}	t_gnl_job;
+
+// raw io_uring: the mapped submission / completion rings (fd < 0: none)
+// queued: sqes written but not submitted yet, fixed: buffers registered
+typedef struct s_gnl_uring
+{
+	int			fd;
+	int			fixed;
+	unsigned	queued;
+	unsigned	*sq_head;
+	unsigned	*sq_tail;
+	unsigned	*sq_mask;
+	unsigned	*sq_array;
+	unsigned	*cq_head;
+	unsigned	*cq_tail;
+	unsigned	*cq_mask;
+	void		*sqes;
+	void		*cqes;
+	void		*sq_map;
+	void		*cq_map;
+	size_t		sq_len;
+	size_t		cq_len;
+	size_t		sqes_len;
+}	t_gnl_uring;
+
+// one fd of a gnl_ring: its reader, its GNL_RING_BUF read buffer and
+// busy: waiting on a read, queued: in the ready queue, eof: no more reads
+// gone: dropped while its io_uring read was still in flight
+typedef struct s_gnl_rfd
+{
+	t_gnl_reader		*r;
+	char				*buf;
+	int					busy;
+	int					queued;
+	int					eof;
+	int					gone;
+	struct s_gnl_rfd	*next;
+}	t_gnl_rfd;
+
+// FIFO of t_gnl_rfd, linked through their next field
+typedef struct s_gnl_queue
+{
+	t_gnl_rfd	*head;
+	t_gnl_rfd	*tail;
+}	t_gnl_queue;
+
+// busy: number of entries waiting on a read
+// ready: entries whose stash may hold a line (or their final bytes)
+// pfd / pidx: poll() fallback scratch (pidx maps pfd back to ent)
+struct s_gnl_ring
+{
+	t_gnl_uring		u;
+	unsigned		max;
+	t_gnl_rfd		*ent;
+	char			*bufs;
+	unsigned		busy;
+	t_gnl_queue		ready;
+	struct pollfd	*pfd;
+	unsigned		*pidx;
+};
+
+// epoll multiplexer: byfd[fd] is the entry of a watched fd (nfd slots),
+// count the number of watched fds, ready the fds that may have a line
+// ev: epoll_wait() scratch, GNL_MUX_EVENTS long
+struct s_gnl_mux
+{
+	int					ep;
+	t_gnl_rfd			**byfd;
+	size_t				nfd;
+	size_t				count;
+	t_gnl_queue			ready;
+	struct epoll_event	*ev;
+};
+
+// gnl_parse_double() scratch: the number is m * 10^e, digits: how many
+// mantissa digits were seen, dropped: some did not fit in m (inexact)
+typedef struct s_gnl_num
+{
+	unsigned long	m;
+	long			e;
+	size_t			digits;
+	int				dropped;
+}	t_gnl_num;
+
+// machine word read through any char buffer by the SWAR scanner
+typedef unsigned long __attribute__((may_alias))	t_word;
+
+// delimiter scanner: same contract as memchr()
+typedef char						*(*t_scan)(char *s, int c, size_t n);
+
+// byte counter, see gnl_memcount()
+typedef size_t						(*t_count)(char *s, int c, size_t n);
+
+t_gnl_reader	*gnl_fd_reader(int fd);
+t_fdtab			*gnl_fdtab(void);
+void			gnl_fd_sweep(t_fdtab *tab);
+void			gnl_fd_reset(t_gnl_reader *r);
+char			*gnl_free(t_stash *st);
+char			*gnl_end(t_stash *st, ssize_t rd);
+int				gnl_reserve(t_stash *st, size_t n);
+void			gnl_delim_init(t_gnl_reader *r);
+size_t			gnl_find(t_gnl_reader *r);
+size_t			gnl_keep(t_gnl_reader *r, size_t n);
+ssize_t			gnl_read(t_gnl_reader *r);
+ssize_t			gnl_fill(t_gnl_reader *r);
+void			gnl_skip(t_stash *st, size_t n);
+int				gnl_map(int fd, t_stash *st);
+int				gnl_unmap(t_stash *st, size_t n);
+void			gnl_mem(t_gnl_reader *r, char *buf, size_t len);
+size_t			gnl_slice_start(char *map, size_t size, int i, int n);
+int				gnl_idx_write(const char *path, t_gnl_idx_hdr *h,
+					uint64_t *out);
+uint64_t		gnl_idx_sum(const t_gnl_idx_hdr *h);
+int				gnl_idx_fresh(const t_gnl_idx_hdr *h, int fd);
+char			*gnl_memchr(char *s, int c, size_t n);
+char			*gnl_memrchr(char *s, int c, size_t n);
+char			*gnl_memmem(char *s, size_t n, const char *pat, size_t plen);
+char			*gnl_memchr_swar(char *s, int c, size_t n);
+char			*gnl_memchr_sse2(char *s, int c, size_t n);
+char			*gnl_memchr_avx2(char *s, int c, size_t n);
+char			*gnl_memchr_avx512(char *s, int c, size_t n);
+size_t			gnl_memcount(char *s, int c, size_t n);
+size_t			gnl_memcount_swar(char *s, int c, size_t n);
+size_t			gnl_memcount_sse2(char *s, int c, size_t n);
+size_t			gnl_memcount_avx2(char *s, int c, size_t n);
+size_t			gnl_memcount_avx512(char *s, int c, size_t n);
+void			gnl_memcpy(char *dst, char *src, size_t n);
+void			gnl_bzero(void *p, size_t n);
+char			*gnl_substr(char *s, size_t start, size_t len);
+char			*gnl_line(t_gnl_reader *r, size_t len);
+void			gnl_wait(int *addr, int val);
+ssize_t			gnl_prefetch_read(t_gnl_reader *r);
+void			gnl_prefetch_stop(t_gnl_reader *r);
+void			gnl_uring_read(t_gnl_ring *ring, t_gnl_rfd *e);
+void			gnl_uring_close(t_gnl_uring *u);
+int				gnl_ring_wait(t_gnl_ring *ring);
+int				gnl_poll_wait(t_gnl_ring *ring);
+void			gnl_ring_want(t_gnl_ring *ring, t_gnl_rfd *e);
+int				gnl_ring_done(t_gnl_ring *ring, t_gnl_rfd *e, ssize_t res);
+void			gnl_ring_drop(t_gnl_ring *ring, t_gnl_rfd *e);
+void			gnl_queue_push(t_gnl_queue *q, t_gnl_rfd *e);
+void			gnl_queue_unlink(t_gnl_queue *q, t_gnl_rfd *e);
+ssize_t			gnl_src_read(const t_gnl_src *src, int fd, char *buf,
+					size_t n);
+int				gnl_parse_lead(const char *s, size_t len, size_t *i);
+int				gnl_parse_end(const char *s, size_t len, size_t i);
+ssize_t			gnl_stat_read(t_gnl_reader *r, char *buf, size_t n);
+void			gnl_stat_wait(t_stash *st, int *addr, int val);
+
+#endif
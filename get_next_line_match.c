@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_match.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:45:04 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:54:01 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+#include <errno.h>
+
+// the next n stash bytes are the matching line: served as by gnl_next()
+static char	*gnl_match_serve(t_gnl_reader *r, size_t n)
+{
+	char	*line;
+
+	line = gnl_line(r, n);
+	if (!line)
+		return (gnl_free(&r->st));
+	gnl_skip(&r->st, n);
+	return (line);
+}
+
+// search the stash from off + *from on (there is no delimiter before
+// that); no hit: every complete line in it is dropped, the partial last one
+// is kept, *from is where the next search resumes (a hit may straddle the
+// next read)
+// a hit: the stash starts at its line, the line length if it is complete
+// (0 and *from on the hit if not: more input needed)
+static size_t	gnl_match_find(t_gnl_reader *r, const char *pat, size_t plen,
+		size_t *from)
+{
+	char	*s;
+	char	*hit;
+	char	*nl;
+
+	s = r->st.buf + r->st.off + *from;
+	hit = gnl_memmem(s, r->st.buf + r->st.len - s, pat, plen);
+	if (hit)
+		nl = gnl_memrchr(s, r->delim[0], hit - s);
+	else
+		nl = gnl_memrchr(s, r->delim[0], r->st.buf + r->st.len - s);
+	if (nl)
+	{
+		r->st.off = nl + 1 - r->st.buf;
+		r->st.scan = 0;
+	}
+	if (hit)
+	{
+		*from = hit - r->st.buf - r->st.off;
+		return (gnl_find(r));
+	}
+	*from = 0;
+	if (r->st.len - r->st.off >= plen)
+		*from = r->st.len - r->st.off - plen + 1;
+	return (0);
+}
+
+// one byte delimiter that is not in the pattern: the pattern is searched
+// over the whole stash (or mapping) at once, lines are only looked for
+// around a hit; nothing is copied for the lines in between
+static char	*gnl_match_raw(t_gnl_reader *r, const char *pat, size_t plen)
+{
+	t_stash	*st;
+	ssize_t	rd;
+	size_t	from;
+	size_t	n;
+
+	st = &r->st;
+	from = 0;
+	rd = 1;
+	while (rd > 0)
+	{
+		n = gnl_match_find(r, pat, plen, &from);
+		if (n)
+			return (gnl_match_serve(r, n));
+		rd = gnl_fill(r);
+	}
+	if (rd == 0 && st->off < st->len
+		&& gnl_memmem(st->buf + st->off, st->len - st->off, pat, plen))
+		return (gnl_match_serve(r, st->len - st->off));
+	if (rd < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+		return (NULL);
+	return (gnl_end(&r->st, rd));
+}
+
+// any other case (opts.max_line, multi-byte delimiter, delimiter in the
+// pattern): line by line, but still without a copy of the other lines
+static char	*gnl_match_lines(t_gnl_reader *r, const char *pat, size_t plen)
+{
+	ssize_t	n;
+
+	while (1)
+	{
+		n = gnl_read(r);
+		if (n == GNL_AGAIN)
+			return (NULL);
+		if (n <= 0)
+			return (gnl_end(&r->st, n));
+		if (gnl_memmem(r->st.buf + r->st.off, n, pat, plen))
+			return (gnl_match_serve(r, n));
+		gnl_skip(&r->st, n);
+	}
+}
+
+// grep -F: the next line of r holding pattern (a fixed string), as a
+// malloc'd copy as gnl_next() returns it; the lines without it are skipped
+// in the stash, never copied nor allocated
+// with opts.max_line, each fragment of a long line is matched on its own
+// NULL on EOF (errno 0), error, or EAGAIN (O_NONBLOCK fd, nothing lost:
+// call again)
+char	*gnl_next_match(t_gnl_reader *r, const char *pattern)
+{
+	size_t	plen;
+
+	if (!r || !pattern)
+		return (NULL);
+	if (!pattern[0])
+		return (gnl_next(r));
+	if (!r->dlen)
+		gnl_delim_init(r);
+	plen = 0;
+	while (pattern[plen])
+		plen++;
+	if (r->dlen == 1 && !r->opts.max_line
+		&& !gnl_memchr((char *)pattern, r->delim[0], plen))
+		return (gnl_match_raw(r, pattern, plen));
+	return (gnl_match_lines(r, pattern, plen));
+}
@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_mmap.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:39:09 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:33:21 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// offset of fd if it is a regular file with at least GNL_MMAP_MIN unread
+// bytes (stat in *sb), -1 otherwise
+static off_t	gnl_map_pos(int fd, struct stat *sb)
+{
+	off_t	pos;
+
+	if (!GNL_MMAP || fstat(fd, sb) < 0 || !S_ISREG(sb->st_mode))
+		return (-1);
+	pos = lseek(fd, 0, SEEK_CUR);
+	if (pos < 0 || sb->st_size - pos < GNL_MMAP_MIN)
+		return (-1);
+	return (pos);
+}
+
+// regular file with at least GNL_MMAP_MIN unread bytes: map the rest of it
+// and serve lines straight from the mapping instead of read()-ing it
+// the fd offset is moved to the end of the mapping, so once the mapping is
+// used up the read() path picks up whatever was appended in the meantime
+// returns 1 if the stash now holds the mapping, 0 otherwise (use read())
+int	gnl_map(int fd, t_stash *st)
+{
+	struct stat	sb;
+	off_t		pos;
+	off_t		base;
+	char		*map;
+
+	pos = gnl_map_pos(fd, &sb);
+	if (pos < 0)
+		return (0);
+	base = pos - pos % sysconf(_SC_PAGESIZE);
+	map = mmap(NULL, sb.st_size - base, PROT_READ, MAP_PRIVATE, fd, base);
+	if (map == MAP_FAILED)
+		return (0);
+	if (lseek(fd, sb.st_size, SEEK_SET) < 0)
+	{
+		munmap(map, sb.st_size - base);
+		return (0);
+	}
+	madvise(map, sb.st_size - base, MADV_SEQUENTIAL);
+	st->buf = map;
+	st->map = sb.st_size - base;
+	st->len = st->map;
+	st->off = pos - base;
+	st->scan = 0;
+	return (1);
+}
+
+// leave mmap mode: copy the unconsumed tail of the mapping into a malloc'd
+// buffer with room for n more bytes and drop the mapping
+int	gnl_unmap(t_stash *st, size_t n)
+{
+	size_t	tail;
+	size_t	cap;
+	char	*new;
+
+	tail = st->len - st->off;
+	cap = tail * 2;
+	if (cap < tail + n)
+		cap = tail + n;
+	new = malloc(cap);
+	if (!new)
+		return (0);
+	gnl_memcpy(new, st->buf + st->off, tail);
+	GNL_STAT(st, bytes_copied, tail);
+	GNL_STAT(st, allocs, 1);
+	munmap(st->buf, st->map);
+	st->buf = new;
+	st->map = 0;
+	st->cap = cap;
+	st->len = tail;
+	st->off = 0;
+	return (1);
+}
+
+// reader over a caller-owned memory block: lines are served straight out of
+// buf[0 .. len], which is never written to, grown or freed
+void	gnl_mem(t_gnl_reader *r, char *buf, size_t len)
+{
+	gnl_bzero(r, sizeof(*r));
+	r->fd = -1;
+	r->st.mem = 1;
+	r->st.buf = buf;
+	r->st.len = len;
+}
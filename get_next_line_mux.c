@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_mux.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:00:32 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 10:00:58 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+#include <errno.h>
+#include <fcntl.h>
+
+#ifdef __linux__
+# include <sys/epoll.h>
+
+t_gnl_mux	*gnl_mux_new(void)
+{
+	t_gnl_mux	*mux;
+
+	mux = calloc(1, sizeof(*mux));
+	if (!mux)
+		return (NULL);
+	mux->ev = malloc(GNL_MUX_EVENTS * sizeof(*mux->ev));
+	mux->ep = epoll_create1(EPOLL_CLOEXEC);
+	if (!mux->ev || mux->ep < 0)
+	{
+		gnl_mux_free(mux);
+		return (NULL);
+	}
+	return (mux);
+}
+
+// grow (x2) the fd -> entry index so that it covers fd
+static int	gnl_mux_grow(t_gnl_mux *mux, int fd)
+{
+	size_t		n;
+	t_gnl_rfd	**new;
+
+	n = mux->nfd * 2;
+	if (n <= (size_t)fd)
+		n = (size_t)fd + 1;
+	new = calloc(n, sizeof(*new));
+	if (!new)
+		return (0);
+	if (mux->nfd)
+		gnl_memcpy((char *)new, (char *)mux->byfd,
+			mux->nfd * sizeof(*new));
+	free(mux->byfd);
+	mux->byfd = new;
+	mux->nfd = n;
+	return (1);
+}
+
+// new entry with a reader on fd, NULL if out of memory
+static t_gnl_rfd	*gnl_mux_entry(int fd)
+{
+	t_gnl_opts	opts;
+	t_gnl_rfd	*e;
+
+	gnl_bzero(&opts, sizeof(opts));
+	opts.no_mmap = 1;
+	e = calloc(1, sizeof(*e));
+	if (e)
+		e->r = gnl_open(fd, &opts);
+	if (e && !e->r)
+	{
+		free(e);
+		return (NULL);
+	}
+	return (e);
+}
+
+// a failed gnl_mux_add(): drop the entry e (and its epoll watch, if fd is
+// not -1); errno is kept
+static int	gnl_mux_fail(t_gnl_mux *mux, t_gnl_rfd *e, int fd)
+{
+	int	err;
+
+	err = errno;
+	if (fd >= 0)
+		epoll_ctl(mux->ep, EPOLL_CTL_DEL, fd, NULL);
+	if (e)
+		gnl_close(e->r);
+	free(e);
+	errno = err;
+	return (-1);
+}
+
+// watch fd (level-triggered), it is switched to O_NONBLOCK so that a
+// ready fd is read only as far as it goes, the fd stays owned by the caller
+// returns 0, or -1 if fd is already in or cannot be watched (epoll takes
+// pipes, sockets, ttys..., not regular files: use gnl_ring for those)
+// epoll checks fd first: a failed add leaves its flags (and the fd index)
+// as they were
+int	gnl_mux_add(t_gnl_mux *mux, int fd)
+{
+	struct epoll_event	ev;
+	t_gnl_rfd			*e;
+	int					flags;
+
+	if (fd < 0 || ((size_t)fd < mux->nfd && mux->byfd[fd]))
+		return (-1);
+	e = gnl_mux_entry(fd);
+	ev.events = EPOLLIN;
+	ev.data.ptr = e;
+	if (!e || epoll_ctl(mux->ep, EPOLL_CTL_ADD, fd, &ev) < 0)
+		return (gnl_mux_fail(mux, e, -1));
+	flags = fcntl(fd, F_GETFL);
+	if (((size_t)fd >= mux->nfd && !gnl_mux_grow(mux, fd)) || flags < 0
+		|| fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0)
+		return (gnl_mux_fail(mux, e, fd));
+	mux->byfd[fd] = e;
+	mux->count++;
+	return (0);
+}
+
+#else
+
+t_gnl_mux	*gnl_mux_new(void)
+{
+	return (NULL);
+}
+
+int	gnl_mux_add(t_gnl_mux *mux, int fd)
+{
+	(void)mux;
+	(void)fd;
+	return (-1);
+}
+
+#endif
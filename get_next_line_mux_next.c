@@ -0,0 +1,154 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_mux_next.c                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:00:32 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 10:07:52 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+#include <errno.h>
+
+#ifdef __linux__
+# include <sys/epoll.h>
+
+// stop watching fd, whatever its stash still holds is dropped
+void	gnl_mux_remove(t_gnl_mux *mux, int fd)
+{
+	t_gnl_rfd	*e;
+
+	if (fd < 0 || (size_t)fd >= mux->nfd || !mux->byfd[fd])
+		return ;
+	e = mux->byfd[fd];
+	if (e->queued)
+		gnl_queue_unlink(&mux->ready, e);
+	epoll_ctl(mux->ep, EPOLL_CTL_DEL, fd, NULL);
+	gnl_close(e->r);
+	free(e);
+	mux->byfd[fd] = NULL;
+	mux->count--;
+}
+
+void	gnl_mux_free(t_gnl_mux *mux)
+{
+	size_t	fd;
+
+	if (!mux)
+		return ;
+	fd = 0;
+	while (fd < mux->nfd)
+		gnl_mux_remove(mux, fd++);
+	if (mux->ep >= 0)
+		close(mux->ep);
+	free(mux->byfd);
+	free(mux->ev);
+	free(mux);
+}
+
+// one epoll_wait(): every fd reported readable joins the ready queue
+// returns the number of fds reported, -1 on error
+static int	gnl_mux_wait(t_gnl_mux *mux, int timeout)
+{
+	int			n;
+	int			i;
+	t_gnl_rfd	*e;
+
+	n = epoll_wait(mux->ep, mux->ev, GNL_MUX_EVENTS, timeout);
+	i = 0;
+	while (i < n)
+	{
+		e = mux->ev[i++].data.ptr;
+		if (!e->queued)
+			gnl_queue_push(&mux->ready, e);
+	}
+	return (n);
+}
+
+// next line of the ready entry e (its fd in *fd); on GNL_AGAIN e leaves
+// the queue until epoll reports it again, on EOF / error its fd is removed
+// from the mux; the entry goes to the back of the queue after each line
+// (round-robin), out of memory it stays at the head, its line unread
+static char	*gnl_mux_line(t_gnl_mux *mux, t_gnl_rfd *e, int *fd)
+{
+	ssize_t	n;
+	char	*line;
+
+	n = gnl_read(e->r);
+	if (n > 0)
+	{
+		*fd = e->r->fd;
+		line = gnl_line(e->r, n);
+		if (!line)
+		{
+			errno = ENOMEM;
+			return (NULL);
+		}
+		gnl_skip(&e->r->st, n);
+		gnl_queue_unlink(&mux->ready, e);
+		gnl_queue_push(&mux->ready, e);
+		return (line);
+	}
+	gnl_queue_unlink(&mux->ready, e);
+	if (n != GNL_AGAIN)
+		gnl_mux_remove(mux, e->r->fd);
+	return (NULL);
+}
+
+// next complete line (malloc'd, '\n' included) from any watched fd, its fd
+// in *fd; only fds that epoll reports ready are ever read, so the work per
+// call is O(ready fds), not O(watched fds)
+// waits up to timeout ms (-1: forever) for one; returns NULL on timeout
+// (errno 0), on error (errno set, EINTR included; ENOMEM with *fd set:
+// that fd's line is kept for the next call), or once no fd is left
+// (an fd leaves the mux by itself after its last line)
+char	*gnl_mux_next(t_gnl_mux *mux, int *fd, int timeout)
+{
+	char	*line;
+	int		n;
+
+	*fd = -1;
+	while (mux->ready.head || mux->count)
+	{
+		if (!mux->ready.head)
+		{
+			n = gnl_mux_wait(mux, timeout);
+			if (n == 0)
+				errno = 0;
+			if (n <= 0)
+				return (NULL);
+		}
+		if (!mux->ready.head)
+			continue ;
+		line = gnl_mux_line(mux, mux->ready.head, fd);
+		if (line || *fd >= 0)
+			return (line);
+	}
+	return (NULL);
+}
+
+#else
+
+void	gnl_mux_free(t_gnl_mux *mux)
+{
+	(void)mux;
+}
+
+void	gnl_mux_remove(t_gnl_mux *mux, int fd)
+{
+	(void)mux;
+	(void)fd;
+}
+
+char	*gnl_mux_next(t_gnl_mux *mux, int *fd, int timeout)
+{
+	(void)mux;
+	(void)fd;
+	(void)timeout;
+	return (NULL);
+}
+
+#endif
@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_parallel.c                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:43:00 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:19:21 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// one worker: plain line loop of a memory reader over its own slice
+static void	*gnl_job_run(void *arg)
+{
+	t_gnl_job		*job;
+	t_gnl_reader	r;
+	const char		*line;
+	size_t			len;
+
+	job = arg;
+	gnl_mem(&r, job->buf, job->len);
+	while (gnl_next_view(&r, &line, &len) == 1)
+		if (job->fn(line, len, job->worker, job->ctx))
+			break ;
+	return (NULL);
+}
+
+// start of the slice of worker i: the first line start at or after i/n
+// of the file (the byte before it is '\n' or it is the start/end of file)
+// (the line index builder cuts its slices the same way)
+size_t	gnl_slice_start(char *map, size_t size, int i, int n)
+{
+	size_t	pos;
+	char	*nl;
+
+	pos = size / n * i + size % n * i / n;
+	if (pos == 0)
+		return (0);
+	nl = gnl_memchr(map + pos - 1, '\n', size - pos + 1);
+	if (!nl)
+		return (size);
+	return (nl - map + 1);
+}
+
+// split map[0 .. size] into n line-aligned slices and run them in parallel
+static int	gnl_jobs(t_gnl_job *job, char *map, size_t size, int n)
+{
+	int		i;
+	size_t	end;
+
+	i = -1;
+	while (++i < n)
+	{
+		job[i].buf = map + gnl_slice_start(map, size, i, n);
+		end = gnl_slice_start(map, size, i + 1, n);
+		job[i].len = end - (job[i].buf - map);
+		job[i].worker = i;
+		job[i].fn = job[0].fn;
+		job[i].ctx = job[0].ctx;
+		job[i].started = !pthread_create(&job[i].tid, NULL, gnl_job_run,
+				&job[i]);
+		if (!job[i].started)
+			gnl_job_run(&job[i]);
+	}
+	while (--i >= 0)
+		if (job[i].started)
+			pthread_join(job[i].tid, NULL);
+	return (0);
+}
+
+// get_next_line() over a whole regular file, spread across 'workers' threads
+// (<= 0: one per online cpu): the file is cut into byte ranges whose
+// boundaries are moved forward to the next line start, and every worker
+// calls fn(line, len, worker, ctx) for each line of its range, in order
+// worker i only ever sees lines that come before those of worker i + 1,
+// so concatenating the per-worker output gives the sequential output
+// fn returning non zero stops that worker; the fd offset is not used
+// returns 0, or -1 if the fd is not a mappable regular file
+int	gnl_parallel(int fd, int workers, t_gnl_line_fn fn, void *ctx)
+{
+	struct stat	sb;
+	char		*map;
+	t_gnl_job	*job;
+
+	if (workers <= 0)
+		workers = sysconf(_SC_NPROCESSORS_ONLN);
+	if (workers <= 0 || fstat(fd, &sb) < 0 || !S_ISREG(sb.st_mode))
+		return (-1);
+	if (sb.st_size == 0)
+		return (0);
+	job = calloc(workers, sizeof(*job));
+	map = mmap(NULL, sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (!job || map == MAP_FAILED)
+	{
+		free(job);
+		if (map != MAP_FAILED)
+			munmap(map, sb.st_size);
+		return (-1);
+	}
+	job[0].fn = fn;
+	job[0].ctx = ctx;
+	gnl_jobs(job, map, sb.st_size, workers);
+	munmap(map, sb.st_size);
+	free(job);
+	return (0);
+}
@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_parse.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:40:16 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 07:44:00 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+
+// number parsers for field slices (not '\0' terminated): s[0 .. len] must
+// hold exactly one number, blanks around it allowed; 0 on success, -1 if
+// it is not a number (or it overflows); *out is only set on success
+
+// s[*i ..] past blanks, and a sign if there is one: -1 for '-', 1 otherwise
+int	gnl_parse_lead(const char *s, size_t len, size_t *i)
+{
+	int	sign;
+
+	sign = 1;
+	while (*i < len && (s[*i] == ' ' || s[*i] == '\t'))
+		(*i)++;
+	if (*i < len && (s[*i] == '-' || s[*i] == '+'))
+	{
+		if (s[*i] == '-')
+			sign = -1;
+		(*i)++;
+	}
+	return (sign);
+}
+
+// only blanks left after s[i]
+int	gnl_parse_end(const char *s, size_t len, size_t i)
+{
+	while (i < len && (s[i] == ' ' || s[i] == '\t'))
+		i++;
+	return (-(i < len));
+}
+
+int	gnl_parse_long(const char *s, size_t len, long *out)
+{
+	size_t			i;
+	size_t			start;
+	int				sign;
+	unsigned long	n;
+	unsigned long	max;
+
+	i = 0;
+	sign = gnl_parse_lead(s, len, &i);
+	max = (unsigned long)LONG_MAX + (sign < 0);
+	n = 0;
+	start = i;
+	while (i < len && s[i] >= '0' && s[i] <= '9')
+	{
+		if (n > (max - (s[i] - '0')) / 10)
+			return (-1);
+		n = n * 10 + (s[i++] - '0');
+	}
+	if (i == start || gnl_parse_end(s, len, i) < 0)
+		return (-1);
+	*out = n;
+	if (sign < 0 && n)
+		*out = -(long)(n - 1) - 1;
+	return (0);
+}
@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_parse_double.c                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:40:42 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 07:44:00 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+
+// digits of s[*i ..] with at most one '.' among them: the first 19
+// significant ones go to num->m, num->e counts the dropped and the
+// fractional ones
+static void	gnl_parse_mant(const char *s, size_t len, size_t *i, t_gnl_num *n)
+{
+	int	dot;
+
+	dot = 0;
+	while (*i < len && ((s[*i] >= '0' && s[*i] <= '9')
+			|| (s[*i] == '.' && !dot)))
+	{
+		if (s[*i] == '.')
+			dot = 1;
+		else if (n->m < 1000000000000000000UL)
+		{
+			n->m = n->m * 10 + (s[*i] - '0');
+			n->e -= dot;
+		}
+		else
+		{
+			n->dropped |= (s[*i] != '0');
+			n->e += !dot;
+		}
+		n->digits += (s[*i] != '.');
+		(*i)++;
+	}
+}
+
+// "e-12" and the like after the mantissa, 0, or -1 if it has no digits
+static int	gnl_parse_exp(const char *s, size_t len, size_t *i, t_gnl_num *n)
+{
+	int		sign;
+	long	e;
+	size_t	start;
+
+	(*i)++;
+	sign = 1;
+	if (*i < len && (s[*i] == '-' || s[*i] == '+'))
+		sign = 1 - 2 * (s[(*i)++] == '-');
+	e = 0;
+	start = *i;
+	while (*i < len && s[*i] >= '0' && s[*i] <= '9')
+	{
+		if (e < 100000)
+			e = e * 10 + (s[*i] - '0');
+		(*i)++;
+	}
+	n->e += sign * e;
+	return (-(*i == start));
+}
+
+// m * 10^e is exact in a double when m <= 2^53 and |e| <= 22 (both are
+// then exactly representable, one rounding); strtod() for everything else,
+// on a '\0' terminated copy (the slice is not), malloc'd only if it is
+// a long one; returns -1 if that malloc fails
+static int	gnl_parse_value(const char *s, size_t len, t_gnl_num *n, double *v)
+{
+	static const double	p10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+		1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18,
+		1e19, 1e20, 1e21, 1e22};
+	char				tmp[128];
+	char				*copy;
+
+	if (!n->dropped && n->m <= (1UL << 53) && n->e >= -22 && n->e <= 22)
+	{
+		*v = (double)n->m * p10[n->e * (n->e > 0)];
+		if (n->e < 0)
+			*v = (double)n->m / p10[-n->e];
+		return (0);
+	}
+	copy = tmp;
+	if (len >= sizeof(tmp))
+		copy = malloc(len + 1);
+	if (!copy)
+		return (-1);
+	gnl_memcpy(copy, (char *)s, len);
+	copy[len] = '\0';
+	*v = strtod(copy, NULL);
+	if (copy != tmp)
+		free(copy);
+	return (0);
+}
+
+// decimal floating point: [+-]digits[.digits][(e|E)[+-]digits], at least
+// one mantissa digit; exact (correctly rounded) like strtod()
+// (no inf / nan / hex floats)
+int	gnl_parse_double(const char *s, size_t len, double *out)
+{
+	t_gnl_num	n;
+	size_t		i;
+	size_t		start;
+	int			sign;
+
+	gnl_bzero(&n, sizeof(n));
+	i = 0;
+	sign = gnl_parse_lead(s, len, &i);
+	start = i;
+	gnl_parse_mant(s, len, &i, &n);
+	if (!n.digits)
+		return (-1);
+	if (i < len && (s[i] == 'e' || s[i] == 'E') && gnl_parse_exp(s, len, &i,
+			&n) < 0)
+		return (-1);
+	if (gnl_parse_end(s, len, i) < 0)
+		return (-1);
+	if (gnl_parse_value(s + start, i - start, &n, out) < 0)
+		return (-1);
+	*out *= sign;
+	return (0);
+}
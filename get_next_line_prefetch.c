@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_prefetch.c                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:49:12 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:52:25 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+#include <errno.h>
+
+// producer: fill the two buffers in turn, each one as soon as the consumer
+// has handed it back; a read() <= 0 is passed on as is (with its errno)
+// and ends the thread, but for EAGAIN (O_NONBLOCK fd or source without
+// data): the thread then stays parked on that buffer, the consumer reads
+// into it itself until data comes (see gnl_prefetch_again)
+static void	*gnl_prefetch_run(void *arg)
+{
+	t_gnl_prefetch	*pf;
+	int				i;
+	ssize_t			rd;
+	int				again;
+
+	pf = arg;
+	i = 0;
+	while (!__atomic_load_n(&pf->stop, __ATOMIC_ACQUIRE))
+	{
+		gnl_wait(&pf->state[i], GNL_PF_FULL);
+		if (__atomic_load_n(&pf->stop, __ATOMIC_ACQUIRE))
+			break ;
+		rd = gnl_src_read(&pf->src, pf->fd, pf->buf[i], pf->size);
+		pf->len[i] = rd;
+		pf->err[i] = 0;
+		if (rd < 0)
+			pf->err[i] = errno;
+		again = (rd < 0 && (errno == EAGAIN || errno == EWOULDBLOCK));
+		__atomic_store_n(&pf->state[i], GNL_PF_FULL, __ATOMIC_RELEASE);
+		GNL_FUTEX_WAKE(&pf->state[i]);
+		if (rd <= 0 && !again)
+			break ;
+		i ^= (rd > 0);
+	}
+	return (NULL);
+}
+
+static int	gnl_prefetch_start(t_gnl_reader *r)
+{
+	t_gnl_prefetch	*pf;
+
+	pf = calloc(1, sizeof(*pf));
+	if (!pf)
+		return (-1);
+	pf->fd = r->fd;
+	pf->src = r->src;
+	pf->size = r->rmax;
+	pf->buf[0] = malloc(pf->size);
+	pf->buf[1] = malloc(pf->size);
+	if (!pf->buf[0] || !pf->buf[1]
+		|| pthread_create(&pf->tid, NULL, gnl_prefetch_run, pf))
+	{
+		free(pf->buf[0]);
+		free(pf->buf[1]);
+		free(pf);
+		return (-1);
+	}
+	r->pf = pf;
+	return (0);
+}
+
+// the producer got EAGAIN on the consumer's buffer and waits on it: the
+// consumer read()s into it itself (now, not what was there before the
+// caller's poll()), errno left as that read() set it; returns 1 then
+static int	gnl_prefetch_again(t_gnl_prefetch *pf)
+{
+	int	err;
+
+	err = pf->err[pf->slot];
+	if (err != EAGAIN && err != EWOULDBLOCK)
+		return (0);
+	if (pf->len[pf->slot] < 0)
+		pf->len[pf->slot] = gnl_src_read(&pf->src, pf->fd,
+				pf->buf[pf->slot], pf->size);
+	return (1);
+}
+
+// consumer: take the next full buffer, append it to the stash and hand the
+// buffer back right away, so the next read() overlaps with line splitting
+// (the same buffer again after gnl_prefetch_again: the producer waits on it)
+// returns what the producer's read() returned (0: EOF, -1: error, with the
+// producer's errno)
+ssize_t	gnl_prefetch_read(t_gnl_reader *r)
+{
+	t_gnl_prefetch	*pf;
+	ssize_t			rd;
+	int				again;
+
+	if (!r->pf && gnl_prefetch_start(r) < 0)
+		return (-1);
+	pf = r->pf;
+	GNL_WAIT(&r->st, &pf->state[pf->slot], GNL_PF_EMPTY);
+	GNL_STAT(&r->st, reads, 1);
+	again = gnl_prefetch_again(pf);
+	rd = pf->len[pf->slot];
+	if (rd < 0 && !again)
+		errno = pf->err[pf->slot];
+	if (rd <= 0)
+		return (rd);
+	if (!gnl_reserve(&r->st, rd))
+		return (-1);
+	gnl_memcpy(r->st.buf + r->st.len, pf->buf[pf->slot], rd);
+	GNL_STAT(&r->st, bytes_read, rd);
+	GNL_STAT(&r->st, bytes_copied, rd);
+	r->st.len += rd;
+	__atomic_store_n(&pf->state[pf->slot], GNL_PF_EMPTY, __ATOMIC_RELEASE);
+	GNL_FUTEX_WAKE(&pf->state[pf->slot]);
+	pf->slot ^= !again;
+	return (rd);
+}
+
+// the producer is either parked on a buffer (woken up through stop) or
+// inside read(), which is a cancellation point
+void	gnl_prefetch_stop(t_gnl_reader *r)
+{
+	t_gnl_prefetch	*pf;
+
+	pf = r->pf;
+	if (!pf)
+		return ;
+	__atomic_store_n(&pf->stop, 1, __ATOMIC_RELEASE);
+	__atomic_store_n(&pf->state[0], GNL_PF_EMPTY, __ATOMIC_RELEASE);
+	__atomic_store_n(&pf->state[1], GNL_PF_EMPTY, __ATOMIC_RELEASE);
+	GNL_FUTEX_WAKE(&pf->state[0]);
+	GNL_FUTEX_WAKE(&pf->state[1]);
+	pthread_cancel(pf->tid);
+	pthread_join(pf->tid, NULL);
+	free(pf->buf[0]);
+	free(pf->buf[1]);
+	free(pf);
+	r->pf = NULL;
+}
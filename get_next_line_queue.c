@@ -0,0 +1,45 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_queue.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:59:56 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 06:59:56 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+
+// ready queue (gnl_ring, gnl_mux): entries whose stash may hold a line
+void	gnl_queue_push(t_gnl_queue *q, t_gnl_rfd *e)
+{
+	e->next = NULL;
+	e->queued = 1;
+	if (q->tail)
+		q->tail->next = e;
+	else
+		q->head = e;
+	q->tail = e;
+}
+
+void	gnl_queue_unlink(t_gnl_queue *q, t_gnl_rfd *e)
+{
+	t_gnl_rfd	*prev;
+
+	prev = NULL;
+	if (q->head != e)
+	{
+		prev = q->head;
+		while (prev->next != e)
+			prev = prev->next;
+		prev->next = e->next;
+	}
+	else
+		q->head = e->next;
+	if (q->tail == e)
+		q->tail = prev;
+	e->next = NULL;
+	e->queued = 0;
+}
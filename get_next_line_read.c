@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_read.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:47:28 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:24:12 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+#include <errno.h>
+
+// first read() is opts.read_size bytes (0: BUFFER_SIZE), the size doubles
+// after every read() that fills it, up to opts.read_max (0: GNL_READ_MAX)
+// a tty never grows: it returns one typed line per read() anyway
+static void	gnl_read_init(t_gnl_reader *r)
+{
+	r->rsize = r->opts.read_size;
+	if (!r->rsize)
+		r->rsize = BUFFER_SIZE;
+	r->rmax = r->opts.read_max;
+	if (!r->rmax)
+		r->rmax = GNL_READ_MAX;
+	if (r->rmax < r->rsize || (r->fd >= 0 && isatty(r->fd)))
+		r->rmax = r->rsize;
+}
+
+// one read() straight into the free tail of the stash
+// (or the next read-ahead block, see gnl_prefetch_read)
+// with opts.max_line, never more than what gnl_find() searches
+static ssize_t	gnl_read_more(t_gnl_reader *r)
+{
+	ssize_t	rd;
+	size_t	n;
+	size_t	max;
+
+	if (r->opts.prefetch)
+		return (gnl_prefetch_read(r));
+	n = r->rsize;
+	max = r->opts.max_line + r->dlen - (r->st.len - r->st.off);
+	if (r->opts.max_line && n > max)
+		n = max;
+	if (!gnl_reserve(&r->st, n))
+		return (-1);
+	rd = GNL_READ(r, r->st.buf + r->st.len, n);
+	if (rd > 0)
+		r->st.len += rd;
+	if (rd == (ssize_t)r->rsize && r->rsize < r->rmax)
+	{
+		r->rsize *= 2;
+		if (r->rsize > r->rmax)
+			r->rsize = r->rmax;
+	}
+	return (rd);
+}
+
+// more input in the stash: a fresh stash on a big regular file is mmap()-ed
+// (see gnl_map), any other gets one more read()
+// a memory stash (see gnl_mem) is never read into, its end is EOF
+// returns the number of bytes added, 0 on EOF, -1 (errno set) on error
+ssize_t	gnl_fill(t_gnl_reader *r)
+{
+	t_stash	*st;
+
+	st = &r->st;
+	if (st->mem)
+		return (0);
+	if (!st->buf && !r->opts.no_mmap && r->fd >= 0 && gnl_map(r->fd, st))
+		return (st->len - st->off);
+	if (!r->rsize)
+		gnl_read_init(r);
+	return (gnl_read_more(r));
+}
+
+// fill stash until a delimiter ('\n' by default) is in it, or EOF
+// the stash buffer lives as long as the reader, no per-call read buffer
+// returns the length of the next line (delimiter included), 0 on EOF,
+// -1 on error; at EOF, what is left is the last line (or, if longer than
+// opts.max_line, its next fragment)
+// or GNL_AGAIN when an O_NONBLOCK fd has no complete line yet; the stash is
+// then left as is, the next call carries on from there
+ssize_t	gnl_read(t_gnl_reader *r)
+{
+	t_stash	*st;
+	size_t	n;
+	ssize_t	rd;
+
+	st = &r->st;
+	rd = 1;
+	while (rd > 0)
+	{
+		n = gnl_find(r);
+		if (n)
+			return (n);
+		rd = gnl_fill(r);
+	}
+	if (rd < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+		return (GNL_AGAIN);
+	if (rd < 0)
+		return (-1);
+	n = st->len - st->off;
+	r->cut = (r->opts.max_line && n > r->opts.max_line);
+	if (r->cut)
+		n = r->opts.max_line;
+	return (n);
+}
@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_reader.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:40:57 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:54:01 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+
+// a reader owns its stash, nothing is shared with other readers or with
+// get_next_line(), so separate readers can be used from separate threads
+// (even two readers on the same fd, if that fd supports it)
+// the fd stays owned by the caller, gnl_close() does not close it
+t_gnl_reader	*gnl_open(int fd, const t_gnl_opts *opts)
+{
+	t_gnl_reader	*r;
+
+	if (fd < 0 || BUFFER_SIZE <= 0)
+		return (NULL);
+	r = calloc(1, sizeof(*r));
+	if (!r)
+		return (NULL);
+	r->fd = fd;
+	if (opts)
+		r->opts = *opts;
+	return (r);
+}
+
+// returns a malloc'd copy of the next line (including its delimiter, '\n'
+// by default, if present and opts.strip is not set)
+// NULL with errno EAGAIN: no complete line yet on an O_NONBLOCK fd, but
+// nothing is lost, call again once the fd is readable; errno 0: EOF
+char	*gnl_next(t_gnl_reader *r)
+{
+	ssize_t	n;
+	char	*line;
+
+	if (!r)
+		return (NULL);
+	n = gnl_read(r);
+	if (n == GNL_AGAIN)
+		return (NULL);
+	if (n <= 0)
+		return (gnl_end(&r->st, n));
+	line = gnl_line(r, n);
+	if (!line)
+		return (gnl_free(&r->st));
+	gnl_skip(&r->st, n);
+	return (line);
+}
+
+// zero-copy variant: *line points into the stash, *len bytes long
+// (delimiter handled as in gnl_next, not '\0' terminated)
+// valid until the next call on the same reader
+// returns 1 if a line was served, 0 on EOF, -1 on error, GNL_AGAIN if an
+// O_NONBLOCK fd has no complete line yet
+int	gnl_next_view(t_gnl_reader *r, const char **line, size_t *len)
+{
+	ssize_t	n;
+
+	*line = NULL;
+	*len = 0;
+	if (!r)
+		return (-1);
+	n = gnl_read(r);
+	if (n == GNL_AGAIN)
+		return (GNL_AGAIN);
+	if (n <= 0)
+	{
+		gnl_free(&r->st);
+		return ((int)n);
+	}
+	*line = r->st.buf + r->st.off;
+	*len = gnl_keep(r, n);
+	gnl_skip(&r->st, n);
+	return (1);
+}
+
+void	gnl_close(t_gnl_reader *r)
+{
+	if (!r)
+		return ;
+	gnl_prefetch_stop(r);
+	gnl_free(&r->st);
+	free(r);
+}
@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_rev.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:23:27 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 07:23:27 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+
+// the fd's size is taken once, lines appended later are not seen
+// the fd offset is left where it was, every read is a pread()
+// returns NULL if fd is not seekable
+t_gnl_rev	*gnl_rev_open(int fd)
+{
+	t_gnl_rev	*rv;
+	off_t		cur;
+	off_t		end;
+
+	cur = lseek(fd, 0, SEEK_CUR);
+	end = lseek(fd, 0, SEEK_END);
+	if (cur < 0 || end < 0 || lseek(fd, cur, SEEK_SET) < 0)
+		return (NULL);
+	rv = calloc(1, sizeof(*rv));
+	if (!rv)
+		return (NULL);
+	rv->fd = fd;
+	rv->pos = end;
+	return (rv);
+}
+
+// room for n bytes in front of buf[lo]: slide the bytes to the end of buf
+// (backwards, the ranges may overlap), grow it (x2) if still short
+static int	gnl_rev_room(t_gnl_rev *rv, size_t n)
+{
+	size_t	i;
+	size_t	cap;
+	char	*new;
+
+	if (rv->lo >= n)
+		return (0);
+	i = rv->len;
+	if (rv->cap - rv->len >= n)
+		while (i--)
+			rv->buf[rv->cap - rv->len + i] = rv->buf[rv->lo + i];
+	if (rv->cap - rv->len >= n)
+	{
+		rv->lo = rv->cap - rv->len;
+		return (0);
+	}
+	cap = (rv->len + n) * 2;
+	new = malloc(cap);
+	if (!new)
+		return (-1);
+	gnl_memcpy(new + cap - rv->len, rv->buf + rv->lo, rv->len);
+	free(rv->buf);
+	rv->buf = new;
+	rv->cap = cap;
+	rv->lo = cap - rv->len;
+	return (0);
+}
+
+// pread() the GNL_REV_BLOCK aligned block in front of the buffered bytes
+static int	gnl_rev_fill(t_gnl_rev *rv)
+{
+	size_t	n;
+	size_t	got;
+	ssize_t	rd;
+
+	n = rv->pos % GNL_REV_BLOCK;
+	if (!n)
+		n = GNL_REV_BLOCK;
+	if (gnl_rev_room(rv, n) < 0)
+		return (-1);
+	got = 0;
+	while (got < n)
+	{
+		rd = pread(rv->fd, rv->buf + rv->lo - n + got, n - got,
+				rv->pos - n + got);
+		if (rd <= 0)
+			return (-1);
+		got += rd;
+	}
+	rv->lo -= n;
+	rv->len += n;
+	rv->pos -= n;
+	return (0);
+}
+
+// the lines of the file from the last one to the first one, each as a
+// malloc'd copy ('\n' included if present, exactly as get_next_line()
+// returns it); only the blocks holding them are read, from the end on
+// NULL once the first line was served (or on error)
+char	*gnl_rev_next(t_gnl_rev *rv)
+{
+	char	*data;
+	char	*nl;
+	size_t	n;
+
+	if (!rv || (!rv->len && !rv->pos))
+		return (NULL);
+	nl = NULL;
+	while (1)
+	{
+		data = rv->buf + rv->lo;
+		if (rv->len > rv->seen + 1)
+			nl = gnl_memrchr(data, '\n', rv->len - 1 - rv->seen);
+		if (nl || !rv->pos)
+			break ;
+		if (rv->len)
+			rv->seen = rv->len - 1;
+		if (gnl_rev_fill(rv) < 0)
+			return (NULL);
+	}
+	n = rv->len;
+	if (nl)
+		n = data + rv->len - (nl + 1);
+	rv->len -= n;
+	rv->seen = 0;
+	return (gnl_substr(data, rv->len, n));
+}
+
+void	gnl_rev_close(t_gnl_rev *rv)
+{
+	if (!rv)
+		return ;
+	free(rv->buf);
+	free(rv);
+}
@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_ring.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:52:57 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 06:52:57 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+#include <sys/mman.h>
+#include <sys/uio.h>
+
+#ifdef __linux__
+# include <linux/io_uring.h>
+
+// point the ring fields into the two ring mappings
+static void	gnl_uring_ptrs(t_gnl_uring *u, struct io_uring_params *p)
+{
+	u->sq_head = (unsigned *)((char *)u->sq_map + p->sq_off.head);
+	u->sq_tail = (unsigned *)((char *)u->sq_map + p->sq_off.tail);
+	u->sq_mask = (unsigned *)((char *)u->sq_map + p->sq_off.ring_mask);
+	u->sq_array = (unsigned *)((char *)u->sq_map + p->sq_off.array);
+	u->cq_head = (unsigned *)((char *)u->cq_map + p->cq_off.head);
+	u->cq_tail = (unsigned *)((char *)u->cq_map + p->cq_off.tail);
+	u->cq_mask = (unsigned *)((char *)u->cq_map + p->cq_off.ring_mask);
+	u->cqes = (char *)u->cq_map + p->cq_off.cqes;
+}
+
+// io_uring with n entries, its rings mapped the raw way (no liburing)
+// returns 0, or -1 (u->fd < 0) if the kernel does not let us have one
+static int	gnl_uring_setup(t_gnl_uring *u, unsigned n)
+{
+	struct io_uring_params	p;
+
+	gnl_bzero(&p, sizeof(p));
+	u->fd = syscall(__NR_io_uring_setup, n, &p);
+	if (u->fd < 0)
+		return (-1);
+	u->sq_len = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+	u->cq_len = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+	u->sqes_len = p.sq_entries * sizeof(struct io_uring_sqe);
+	u->sq_map = mmap(NULL, u->sq_len, PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_POPULATE, u->fd, IORING_OFF_SQ_RING);
+	u->cq_map = mmap(NULL, u->cq_len, PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_POPULATE, u->fd, IORING_OFF_CQ_RING);
+	u->sqes = mmap(NULL, u->sqes_len, PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_POPULATE, u->fd, IORING_OFF_SQES);
+	if (u->sq_map == MAP_FAILED || u->cq_map == MAP_FAILED
+		|| u->sqes == MAP_FAILED)
+	{
+		gnl_uring_close(u);
+		return (-1);
+	}
+	gnl_uring_ptrs(u, &p);
+	return (0);
+}
+
+// every entry owns a GNL_RING_BUF slice of bufs: register them all once,
+// so reads are IORING_OP_READ_FIXED (no per-read page pinning)
+static void	gnl_uring_register(t_gnl_ring *ring)
+{
+	struct iovec	*iov;
+	unsigned		i;
+
+	iov = malloc(ring->max * sizeof(*iov));
+	if (!iov)
+		return ;
+	i = 0;
+	while (i < ring->max)
+	{
+		iov[i].iov_base = ring->bufs + (size_t)i * GNL_RING_BUF;
+		iov[i].iov_len = GNL_RING_BUF;
+		i++;
+	}
+	ring->u.fixed = !syscall(__NR_io_uring_register, ring->u.fd,
+			IORING_REGISTER_BUFFERS, iov, ring->max);
+	free(iov);
+}
+
+#else
+
+static int	gnl_uring_setup(t_gnl_uring *u, unsigned n)
+{
+	(void)n;
+	u->fd = -1;
+	return (-1);
+}
+
+static void	gnl_uring_register(t_gnl_ring *ring)
+{
+	(void)ring;
+}
+
+#endif
+
+// a ring for up to max fds; io_uring if available (and not GNL_RING_POLL),
+// poll() + read() otherwise, both feed the same per-fd stashes
+t_gnl_ring	*gnl_ring_new(unsigned max, int flags)
+{
+	t_gnl_ring	*ring;
+
+	if (!max)
+		return (NULL);
+	ring = calloc(1, sizeof(*ring));
+	if (!ring)
+		return (NULL);
+	ring->max = max;
+	ring->u.fd = -1;
+	ring->ent = calloc(max, sizeof(*ring->ent));
+	ring->pfd = calloc(max, sizeof(*ring->pfd));
+	ring->pidx = calloc(max, sizeof(*ring->pidx));
+	ring->bufs = malloc((size_t)max * GNL_RING_BUF);
+	if (!ring->ent || !ring->pfd || !ring->pidx || !ring->bufs)
+	{
+		gnl_ring_free(ring);
+		return (NULL);
+	}
+	if (!(flags & GNL_RING_POLL) && gnl_uring_setup(&ring->u, max) == 0)
+		gnl_uring_register(ring);
+	return (ring);
+}
+
+// closing the io_uring cancels whatever read is still in flight
+void	gnl_ring_free(t_gnl_ring *ring)
+{
+	unsigned	i;
+
+	if (!ring)
+		return ;
+	gnl_uring_close(&ring->u);
+	i = 0;
+	while (ring->ent && i < ring->max)
+		gnl_close(ring->ent[i++].r);
+	free(ring->ent);
+	free(ring->pfd);
+	free(ring->pidx);
+	free(ring->bufs);
+	free(ring);
+}
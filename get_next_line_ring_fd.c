@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_ring_fd.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:53:23 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 10:05:38 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+
+// entry e needs more data: one read in flight (io_uring) or one fd to poll
+void	gnl_ring_want(t_gnl_ring *ring, t_gnl_rfd *e)
+{
+	e->busy = 1;
+	ring->busy++;
+	if (ring->u.fd >= 0)
+		gnl_uring_read(ring, e);
+}
+
+// start reading fd through the ring, the fd stays owned by the caller
+// opts (NULL: defaults) as for gnl_open(): delim, strip, max_line and
+// arena apply, the reads themselves are the ring's (no mmap, read_size,
+// read_max or prefetch)
+// returns 0, or -1 if the ring is full
+int	gnl_ring_add(t_gnl_ring *ring, int fd, const t_gnl_opts *opts)
+{
+	t_gnl_opts	o;
+	unsigned	i;
+	t_gnl_rfd	*e;
+
+	i = 0;
+	while (i < ring->max && (ring->ent[i].r || ring->ent[i].busy))
+		i++;
+	if (fd < 0 || i == ring->max)
+		return (-1);
+	gnl_bzero(&o, sizeof(o));
+	if (opts)
+		o = *opts;
+	o.no_mmap = 1;
+	e = &ring->ent[i];
+	gnl_bzero(e, sizeof(*e));
+	e->r = gnl_open(fd, &o);
+	if (!e->r)
+		return (-1);
+	e->buf = ring->bufs + (size_t)i * GNL_RING_BUF;
+	gnl_ring_want(ring, e);
+	return (0);
+}
+
+// forget entry e and whatever its stash still holds
+// a read still in flight in the io_uring keeps the slot (gone) until it
+// completes, so its buffer is never handed to another fd too early
+void	gnl_ring_drop(t_gnl_ring *ring, t_gnl_rfd *e)
+{
+	if (e->queued)
+		gnl_queue_unlink(&ring->ready, e);
+	if (e->busy)
+		ring->busy--;
+	e->gone = e->busy && ring->u.fd >= 0;
+	e->busy = e->gone;
+	gnl_close(e->r);
+	e->r = NULL;
+}
+
+void	gnl_ring_remove(t_gnl_ring *ring, int fd)
+{
+	unsigned	i;
+
+	i = 0;
+	while (i < ring->max)
+	{
+		if (ring->ent[i].r && ring->ent[i].r->fd == fd)
+			gnl_ring_drop(ring, &ring->ent[i]);
+		i++;
+	}
+}
@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_ring_io.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:53:10 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:30:04 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+#include <errno.h>
+#include <sys/mman.h>
+
+#ifdef __linux__
+# include <linux/io_uring.h>
+
+// queue a read of entry e into its own buffer (submitted by gnl_uring_wait)
+// offset -1: from the fd's current position, like read()
+void	gnl_uring_read(t_gnl_ring *ring, t_gnl_rfd *e)
+{
+	t_gnl_uring			*u;
+	struct io_uring_sqe	*sqe;
+	unsigned			tail;
+
+	u = &ring->u;
+	tail = *u->sq_tail;
+	sqe = (struct io_uring_sqe *)u->sqes + (tail & *u->sq_mask);
+	gnl_bzero(sqe, sizeof(*sqe));
+	sqe->opcode = IORING_OP_READ;
+	if (u->fixed)
+		sqe->opcode = IORING_OP_READ_FIXED;
+	sqe->buf_index = e - ring->ent;
+	sqe->fd = e->r->fd;
+	sqe->addr = (unsigned long)e->buf;
+	sqe->len = GNL_RING_BUF;
+	sqe->off = (__u64)-1;
+	sqe->user_data = e - ring->ent;
+	u->sq_array[tail & *u->sq_mask] = tail & *u->sq_mask;
+	__atomic_store_n(u->sq_tail, tail + 1, __ATOMIC_RELEASE);
+	u->queued++;
+}
+
+// submit every queued read in one syscall, sleep until at least one read
+// completes and hand all completions over to gnl_ring_done()
+// returns -1 if that failed (or gnl_ring_done() did, for one of them)
+static int	gnl_uring_wait(t_gnl_ring *ring)
+{
+	t_gnl_uring			*u;
+	struct io_uring_cqe	*cqe;
+	unsigned			head;
+	long				ret;
+	int					err;
+
+	u = &ring->u;
+	ret = syscall(__NR_io_uring_enter, u->fd, u->queued, 1,
+			IORING_ENTER_GETEVENTS, NULL, 0);
+	if (ret < 0 && errno != EINTR)
+		return (-1);
+	if (ret > 0)
+		u->queued -= ret;
+	err = 0;
+	head = *u->cq_head;
+	while (head != __atomic_load_n(u->cq_tail, __ATOMIC_ACQUIRE))
+	{
+		cqe = (struct io_uring_cqe *)u->cqes + (head & *u->cq_mask);
+		err |= gnl_ring_done(ring, &ring->ent[cqe->user_data], cqe->res);
+		head++;
+		__atomic_store_n(u->cq_head, head, __ATOMIC_RELEASE);
+	}
+	return (err);
+}
+
+#else
+
+void	gnl_uring_read(t_gnl_ring *ring, t_gnl_rfd *e)
+{
+	(void)ring;
+	(void)e;
+}
+
+static int	gnl_uring_wait(t_gnl_ring *ring)
+{
+	(void)ring;
+	return (-1);
+}
+
+#endif
+
+void	gnl_uring_close(t_gnl_uring *u)
+{
+	if (u->sq_map && u->sq_map != MAP_FAILED)
+		munmap(u->sq_map, u->sq_len);
+	if (u->cq_map && u->cq_map != MAP_FAILED)
+		munmap(u->cq_map, u->cq_len);
+	if (u->sqes && u->sqes != MAP_FAILED)
+		munmap(u->sqes, u->sqes_len);
+	if (u->fd >= 0)
+		close(u->fd);
+	gnl_bzero(u, sizeof(*u));
+	u->fd = -1;
+}
+
+int	gnl_ring_wait(t_gnl_ring *ring)
+{
+	if (ring->u.fd >= 0)
+		return (gnl_uring_wait(ring));
+	return (gnl_poll_wait(ring));
+}
@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_ring_next.c                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:53:44 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 10:03:11 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+#include <errno.h>
+
+// append res bytes of the entry's ring buffer to its stash, 0 if out of memory
+static int	gnl_ring_store(t_gnl_rfd *e, ssize_t res)
+{
+	if (!gnl_reserve(&e->r->st, res))
+		return (0);
+	gnl_memcpy(e->r->st.buf + e->r->st.len, e->buf, res);
+	GNL_STAT(&e->r->st, bytes_read, res);
+	GNL_STAT(&e->r->st, bytes_copied, res);
+	e->r->st.len += res;
+	return (1);
+}
+
+// a read of entry e finished with res (read() result, -errno on error):
+// move the data from the entry's ring buffer into its stash
+// EAGAIN / EINTR just ask again, EOF and errors end the fd once its
+// stash is drained; returns -1 with errno ENOMEM if the data could not be
+// stored (the fd is ended too, that data is lost), 0 otherwise
+int	gnl_ring_done(t_gnl_ring *ring, t_gnl_rfd *e, ssize_t res)
+{
+	e->busy = 0;
+	if (e->gone)
+	{
+		e->gone = 0;
+		return (0);
+	}
+	ring->busy--;
+	GNL_STAT(&e->r->st, reads, 1);
+	if (res == -EAGAIN || res == -EINTR)
+	{
+		gnl_ring_want(ring, e);
+		return (0);
+	}
+	if (res > 0 && !gnl_ring_store(e, res))
+		res = -ENOMEM;
+	e->eof = (res <= 0);
+	gnl_queue_push(&ring->ready, e);
+	if (res != -ENOMEM)
+		return (0);
+	errno = ENOMEM;
+	return (-1);
+}
+
+// the next n stash bytes of entry e are its line, e then goes to the back
+// of the queue (round-robin); out of memory: NULL with errno ENOMEM, the
+// bytes stay in the stash and e at the head of the queue
+static char	*gnl_ring_serve(t_gnl_ring *ring, t_gnl_rfd *e, size_t n)
+{
+	char	*line;
+
+	line = gnl_line(e->r, n);
+	if (!line)
+	{
+		errno = ENOMEM;
+		return (NULL);
+	}
+	gnl_skip(&e->r->st, n);
+	gnl_queue_unlink(&ring->ready, e);
+	gnl_queue_push(&ring->ready, e);
+	return (line);
+}
+
+// next line of entry e (its fd in *fd), or NULL once its stash holds no
+// complete line: e then leaves the queue and gets a new read (or is
+// dropped after EOF)
+static char	*gnl_ring_line(t_gnl_ring *ring, t_gnl_rfd *e, int *fd)
+{
+	size_t	n;
+
+	n = gnl_find(e->r);
+	if (!n && e->eof)
+		n = e->r->st.len - e->r->st.off;
+	if (n)
+	{
+		*fd = e->r->fd;
+		return (gnl_ring_serve(ring, e, n));
+	}
+	gnl_queue_unlink(&ring->ready, e);
+	if (e->eof)
+		gnl_ring_drop(ring, e);
+	else
+		gnl_ring_want(ring, e);
+	return (NULL);
+}
+
+// next complete line from any fd of the ring (malloc'd, '\n' included),
+// its fd in *fd; lines of one fd come in order, fds with data are served
+// round-robin, one line each; an fd is dropped after its last line
+// returns NULL once no fd is left, or on error (errno set); ENOMEM with
+// *fd set: that fd's line could not be copied, it is kept and the next
+// call tries it again; ENOMEM with *fd -1: the data of one fd could not be
+// stored, that fd is ended, the others can still be read
+char	*gnl_ring_next(t_gnl_ring *ring, int *fd)
+{
+	char	*line;
+
+	*fd = -1;
+	while (ring->ready.head || ring->busy)
+	{
+		if (!ring->ready.head && gnl_ring_wait(ring) < 0)
+			return (NULL);
+		if (!ring->ready.head)
+			continue ;
+		line = gnl_ring_line(ring, ring->ready.head, fd);
+		if (line || *fd >= 0)
+			return (line);
+	}
+	return (NULL);
+}
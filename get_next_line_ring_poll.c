@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_ring_poll.c                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:25:45 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:25:45 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+#include <errno.h>
+#include <poll.h>
+
+// fill ring->pfd with the fds that want data, returns how many
+static unsigned	gnl_poll_set(t_gnl_ring *ring)
+{
+	unsigned	i;
+	unsigned	n;
+
+	i = 0;
+	n = 0;
+	while (i < ring->max)
+	{
+		if (ring->ent[i].r && ring->ent[i].busy)
+		{
+			ring->pfd[n].fd = ring->ent[i].r->fd;
+			ring->pfd[n].events = POLLIN;
+			ring->pfd[n].revents = 0;
+			ring->pidx[n++] = i;
+		}
+		i++;
+	}
+	return (n);
+}
+
+// fallback: poll() the fds that want data, read() the ready ones
+// returns -1 if poll() failed (or gnl_ring_done() did, for one of them)
+int	gnl_poll_wait(t_gnl_ring *ring)
+{
+	unsigned	n;
+	ssize_t		rd;
+	int			err;
+
+	n = gnl_poll_set(ring);
+	if (poll(ring->pfd, n, -1) < 0 && errno != EINTR)
+		return (-1);
+	err = 0;
+	while (n--)
+	{
+		if (!ring->pfd[n].revents)
+			continue ;
+		rd = read(ring->pfd[n].fd, ring->ent[ring->pidx[n]].buf, GNL_RING_BUF);
+		if (rd < 0)
+			rd = -errno;
+		err |= gnl_ring_done(ring, &ring->ent[ring->pidx[n]], rd);
+	}
+	return (err);
+}
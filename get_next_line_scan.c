@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_scan.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:36:58 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:19:32 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+
+// portable word-at-a-time search (SWAR)
+// x = word ^ (c repeated): a byte of x is 0 where the word holds 'c'
+// ~(((x & 0x7f..) + 0x7f..) | x | 0x7f..) sets the high bit of exactly
+// those bytes (no borrow runs from one byte into the next, so the first
+// one is found from either end, whatever the byte order)
+static size_t	gnl_swar_hit(t_word x)
+{
+	x = ~(((x & (GNL_ONES * 0x7F)) + GNL_ONES * 0x7F) | x | GNL_ONES * 0x7F);
+	if (!x)
+		return (sizeof(t_word));
+	if (GNL_LITTLE_ENDIAN)
+		return (__builtin_ctzl(x) >> 3);
+	return (__builtin_clzl(x) >> 3);
+}
+
+char	*gnl_memchr_swar(char *s, int c, size_t n)
+{
+	size_t	i;
+	size_t	hit;
+	t_word	rep;
+
+	i = 0;
+	while (i < n && ((unsigned long)(s + i) % sizeof(t_word)))
+	{
+		if (s[i] == (char)c)
+			return (s + i);
+		i++;
+	}
+	rep = GNL_ONES * (unsigned char)c;
+	while (i + sizeof(t_word) <= n)
+	{
+		hit = gnl_swar_hit(*(t_word *)(s + i) ^ rep);
+		if (hit < sizeof(t_word))
+			return (s + i + hit);
+		i += sizeof(t_word);
+	}
+	while (i < n && s[i] != (char)c)
+		i++;
+	if (i < n)
+		return (s + i);
+	return (NULL);
+}
+
+// last c in s[0 .. n]: word-at-a-time from the end, a word that may hold c
+// (see gnl_memchr_swar) is then searched byte by byte
+char	*gnl_memrchr(char *s, int c, size_t n)
+{
+	t_word	rep;
+	t_word	x;
+
+	rep = GNL_ONES * (unsigned char)c;
+	while (n && ((unsigned long)(s + n) % sizeof(t_word)))
+		if (s[--n] == (char)c)
+			return (s + n);
+	while (n >= sizeof(t_word))
+	{
+		x = *(t_word *)(s + n - sizeof(t_word)) ^ rep;
+		if ((x - GNL_ONES) & ~x & (GNL_ONES << 7))
+			break ;
+		n -= sizeof(t_word);
+	}
+	while (n)
+		if (s[--n] == (char)c)
+			return (s + n);
+	return (NULL);
+}
+
+// best scanner this cpu can run, picked once via cpuid
+static t_scan	gnl_scan_pick(void)
+{
+	t_scan	scan;
+
+	scan = gnl_memchr_swar;
+	if (GNL_X86)
+	{
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("sse2"))
+			scan = gnl_memchr_sse2;
+		if (__builtin_cpu_supports("avx2"))
+			scan = gnl_memchr_avx2;
+		if (__builtin_cpu_supports("avx512bw"))
+			scan = gnl_memchr_avx512;
+	}
+	return (scan);
+}
+
+// return pointer to first occurence of 'c' in s[0 .. n]
+// return NULL if 'c' not in there
+char	*gnl_memchr(char *s, int c, size_t n)
+{
+	static t_scan	scan;
+	t_scan			cur;
+
+	cur = __atomic_load_n(&scan, __ATOMIC_RELAXED);
+	if (!cur)
+	{
+		cur = gnl_scan_pick();
+		__atomic_store_n(&scan, cur, __ATOMIC_RELAXED);
+	}
+	return (cur(s, c, n));
+}
@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_simd.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:36:58 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 06:36:58 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+
+#if GNL_X86
+# include <immintrin.h>
+
+// 16 bytes per step, the tail (< 16 bytes) is left to the SWAR scanner
+__attribute__((target("sse2")))
+char	*gnl_memchr_sse2(char *s, int c, size_t n)
+{
+	size_t	i;
+	__m128i	rep;
+	int		mask;
+
+	i = 0;
+	rep = _mm_set1_epi8((char)c);
+	while (i + 16 <= n)
+	{
+		mask = _mm_movemask_epi8(_mm_cmpeq_epi8(
+					_mm_loadu_si128((__m128i *)(s + i)), rep));
+		if (mask)
+			return (s + i + __builtin_ctz(mask));
+		i += 16;
+	}
+	return (gnl_memchr_swar(s + i, c, n - i));
+}
+
+// 64 bytes per step (two compares or-ed together, one branch)
+// the tail (< 64 bytes) is left to the SSE2 scanner
+__attribute__((target("avx2")))
+char	*gnl_memchr_avx2(char *s, int c, size_t n)
+{
+	size_t		i;
+	__m256i		rep;
+	__m256i		lo;
+	__m256i		hi;
+
+	i = 0;
+	rep = _mm256_set1_epi8((char)c);
+	while (i + 64 <= n)
+	{
+		lo = _mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i *)(s + i)), rep);
+		hi = _mm256_cmpeq_epi8(
+				_mm256_loadu_si256((__m256i *)(s + i + 32)), rep);
+		if (_mm256_movemask_epi8(_mm256_or_si256(lo, hi)))
+			break ;
+		i += 64;
+	}
+	if (i + 64 <= n && _mm256_movemask_epi8(lo))
+		return (s + i + __builtin_ctz(_mm256_movemask_epi8(lo)));
+	if (i + 64 <= n)
+		return (s + i + 32 + __builtin_ctz(_mm256_movemask_epi8(hi)));
+	return (gnl_memchr_sse2(s + i, c, n - i));
+}
+
+// 64 bytes per step, the tail is read with a masked load (no overread)
+__attribute__((target("avx512f,avx512bw")))
+char	*gnl_memchr_avx512(char *s, int c, size_t n)
+{
+	size_t		i;
+	__m512i		rep;
+	__mmask64	load;
+	__mmask64	mask;
+
+	i = 0;
+	rep = _mm512_set1_epi8((char)c);
+	while (i < n)
+	{
+		load = ~0ULL;
+		if (n - i < 64)
+			load = (1ULL << (n - i)) - 1;
+		mask = _mm512_mask_cmpeq_epi8_mask(load,
+				_mm512_maskz_loadu_epi8(load, s + i), rep);
+		if (mask)
+			return (s + i + __builtin_ctzll(mask));
+		i += 64;
+	}
+	return (NULL);
+}
+
+#else
+
+char	*gnl_memchr_sse2(char *s, int c, size_t n)
+{
+	return (gnl_memchr_swar(s, c, n));
+}
+
+char	*gnl_memchr_avx2(char *s, int c, size_t n)
+{
+	return (gnl_memchr_swar(s, c, n));
+}
+
+char	*gnl_memchr_avx512(char *s, int c, size_t n)
+{
+	return (gnl_memchr_swar(s, c, n));
+}
+
+#endif
@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_skip.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:32:29 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:32:21 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+
+// walk the stash from delimiter to delimiter, up to n of them
+static size_t	gnl_skip_walk(t_stash *st, char c, size_t n, int *part)
+{
+	size_t	done;
+	char	*nl;
+
+	done = 0;
+	while (done < n && st->off < st->len)
+	{
+		nl = gnl_memchr(st->buf + st->off, c, st->len - st->off);
+		if (!nl)
+			break ;
+		st->off = nl - st->buf + 1;
+		*part = 0;
+		done++;
+	}
+	return (done);
+}
+
+// skip the stash up to n delimiters, GNL_COUNT_BLOCK bytes at a time:
+// whole blocks are only counted, the block holding the n-th delimiter is
+// then walked up to it; *part: the skipped bytes end inside a line
+static size_t	gnl_skip_stash(t_stash *st, char c, size_t n, int *part)
+{
+	size_t	done;
+	size_t	blk;
+	size_t	hits;
+
+	done = 0;
+	while (done < n && st->off < st->len)
+	{
+		blk = st->len - st->off;
+		if (blk > GNL_COUNT_BLOCK)
+			blk = GNL_COUNT_BLOCK;
+		hits = gnl_memcount(st->buf + st->off, c, blk);
+		if (done + hits >= n)
+			break ;
+		done += hits;
+		*part = (st->buf[st->off + blk - 1] != c);
+		st->off += blk;
+	}
+	return (done + gnl_skip_walk(st, c, n - done, part));
+}
+
+// one byte delimiter: count straight over the stash and the reads (or the
+// mapping) behind it, no line is ever cut out
+static ssize_t	gnl_skip_raw(t_gnl_reader *r, size_t n)
+{
+	size_t	done;
+	ssize_t	rd;
+	int		part;
+
+	done = 0;
+	part = 0;
+	rd = 1;
+	while (done < n && rd > 0)
+	{
+		done += gnl_skip_stash(&r->st, r->delim[0], n - done, &part);
+		r->st.scan = 0;
+		if (r->st.off == r->st.len && !r->st.map && !r->st.mem)
+		{
+			r->st.off = 0;
+			r->st.len = 0;
+		}
+		if (done < n)
+			rd = gnl_fill(r);
+	}
+	if (rd < 0)
+		return (-1);
+	if (rd == 0)
+		gnl_free(&r->st);
+	return (done + (done < n && part));
+}
+
+// skip the next n lines of r without building them, e.g. a header
+// a last line without delimiter counts as a line, as in gnl_next()
+// (a multi-byte delimiter falls back to a gnl_next_view() loop)
+// returns the number of lines skipped (less than n: EOF was reached),
+// -1 on error (EAGAIN included: meant for blocking input)
+// the next gnl_next() returns line n (if any)
+ssize_t	gnl_skip_lines(t_gnl_reader *r, size_t n)
+{
+	size_t		done;
+	const char	*line;
+	size_t		len;
+	int			ret;
+
+	if (!r)
+		return (-1);
+	if (!r->dlen)
+		gnl_delim_init(r);
+	if (r->dlen == 1)
+		return (gnl_skip_raw(r, n));
+	done = 0;
+	ret = 1;
+	while (done < n && ret == 1)
+	{
+		ret = gnl_next_view(r, &line, &len);
+		done += (ret == 1 && !r->cut);
+	}
+	if (ret < 0)
+		return (-1);
+	return (done);
+}
+
+// number of lines left on fd (all of them on a fresh fd), at wc -l speed;
+// they are consumed: the fd is at EOF afterwards, for get_next_line() too
+// -1 on error
+ssize_t	gnl_count_lines(int fd)
+{
+	t_gnl_reader	*r;
+
+	r = gnl_fd_reader(fd);
+	if (!r)
+		return (-1);
+	return (gnl_skip_lines(r, (size_t)-1 >> 1));
+}
@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_src.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:21:21 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 07:21:21 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+
+// where every reader gets its bytes: src->read() if the reader has a
+// source, read(fd) otherwise
+ssize_t	gnl_src_read(const t_gnl_src *src, int fd, char *buf, size_t n)
+{
+	if (src->read)
+		return (src->read(src->ctx, buf, n));
+	return (read(fd, buf, n));
+}
+
+// reader over any byte producer (a decompressor, a TLS session, ...):
+// the same line splitting as gnl_open(), only read() is src->read()
+// src is copied, its ctx must outlive the reader; mmap never applies
+t_gnl_reader	*gnl_open_src(const t_gnl_src *src, const t_gnl_opts *opts)
+{
+	t_gnl_reader	*r;
+
+	if (!src || !src->read)
+		return (NULL);
+	r = gnl_open(0, opts);
+	if (!r)
+		return (NULL);
+	r->fd = -1;
+	r->src = *src;
+	return (r);
+}
+
+// reader over buf[0 .. len], without a single syscall: lines (and views)
+// are cut straight out of buf, which must stay untouched until gnl_close()
+// (gnl_next() still copies each line, gnl_next_view() does not)
+t_gnl_reader	*gnl_open_mem(const char *buf, size_t len,
+		const t_gnl_opts *opts)
+{
+	t_gnl_reader	*r;
+
+	if (!buf && len)
+		return (NULL);
+	r = malloc(sizeof(*r));
+	if (!r)
+		return (NULL);
+	gnl_mem(r, (char *)buf, len);
+	if (opts)
+		r->opts = *opts;
+	return (r);
+}
@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_stash.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:38:08 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:54:01 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+#include <errno.h>
+#include <sys/mman.h>
+
+// a memory stash keeps its (borrowed) buffer, only consumed to the end,
+// so gnl_seek_line() can still move it back
+char	*gnl_free(t_stash *st)
+{
+	if (st->mem)
+	{
+		st->off = st->len;
+		st->scan = 0;
+		return (NULL);
+	}
+	if (st->map)
+		munmap(st->buf, st->map);
+	else
+		free(st->buf);
+	st->buf = NULL;
+	st->map = 0;
+	st->len = 0;
+	st->cap = 0;
+	st->off = 0;
+	st->scan = 0;
+	return (NULL);
+}
+
+// move the buffer to a new one of at least st->len + n bytes (x2)
+static int	gnl_grow(t_stash *st, size_t n)
+{
+	size_t	cap;
+	char	*new;
+
+	cap = st->cap * 2;
+	if (cap < st->len + n)
+		cap = st->len + n;
+	new = malloc(cap);
+	if (!new)
+		return (0);
+	gnl_memcpy(new, st->buf, st->len);
+	GNL_STAT(st, bytes_copied, st->len);
+	GNL_STAT(st, allocs, 1);
+	free(st->buf);
+	st->buf = new;
+	st->cap = cap;
+	return (1);
+}
+
+// make room for n more bytes after st->len
+// first slide the unconsumed tail to the front, grow (x2) only if still short
+// every byte is moved at most once by the slide and O(1) times by growing
+int	gnl_reserve(t_stash *st, size_t n)
+{
+	if (st->map)
+		return (gnl_unmap(st, n));
+	if (st->off && st->len + n > st->cap)
+	{
+		gnl_memcpy(st->buf, st->buf + st->off, st->len - st->off);
+		GNL_STAT(st, bytes_copied, st->len - st->off);
+		st->len -= st->off;
+		st->off = 0;
+	}
+	if (st->len + n <= st->cap)
+		return (1);
+	return (gnl_grow(st, n));
+}
+
+// no line: rd 0 (EOF) or < 0 (error), the stash is dropped; errno is
+// cleared at EOF, so a NULL line tells EOF (errno 0) from an error
+char	*gnl_end(t_stash *st, ssize_t rd)
+{
+	gnl_free(st);
+	if (rd == 0)
+		errno = 0;
+	return (NULL);
+}
+
+// the served line is only skipped, the bytes stay where they are
+// until the next gnl_reserve(), the buffer itself is reused
+// (a mapping is never rewound, gnl_reserve() drops it once used up)
+void	gnl_skip(t_stash *st, size_t n)
+{
+	GNL_STAT(st, lines, 1);
+	GNL_STAT_MAX(st, max_stash, st->len - st->off);
+	st->off += n;
+	st->scan = 0;
+	if (st->off == st->len && !st->map && !st->mem)
+	{
+		st->off = 0;
+		st->len = 0;
+	}
+}
@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_stats.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:09:22 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:56:37 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+#include <stdio.h>
+
+// counters of a reader (see t_gnl_stats), 0 on success
+// -1 (and *out zeroed) without a reader, or when built without GNL_STATS
+#if GNL_STATS
+
+int	gnl_reader_stats(t_gnl_reader *r, t_gnl_stats *out)
+{
+	gnl_bzero(out, sizeof(*out));
+	if (!r)
+		return (-1);
+	*out = r->st.stats;
+	return (0);
+}
+
+#else
+
+int	gnl_reader_stats(t_gnl_reader *r, t_gnl_stats *out)
+{
+	(void)r;
+	gnl_bzero(out, sizeof(*out));
+	return (-1);
+}
+
+#endif
+
+// counters of the get_next_line(fd) reader of fd, they add up over the
+// whole life of the process (EOF does not reset them)
+// -1 if fd was never read through get_next_line()
+int	gnl_stats(int fd, t_gnl_stats *out)
+{
+	t_fdtab	*tab;
+	size_t	page;
+
+	gnl_bzero(out, sizeof(*out));
+	tab = gnl_fdtab();
+	page = (size_t)fd / GNL_FD_PAGE;
+	if (fd < 0 || page >= tab->npages || !tab->pages[page])
+		return (-1);
+	return (gnl_reader_stats(&tab->pages[page][fd % GNL_FD_PAGE], out));
+}
+
+// one line on stderr per fd that went through get_next_line()
+// registered with atexit() by the first get_next_line() of a GNL_STATS build
+void	gnl_stats_dump(void)
+{
+	t_gnl_stats	s;
+	int			fd;
+
+	fd = 0;
+	while ((size_t)fd < gnl_fdtab()->npages * GNL_FD_PAGE)
+	{
+		if (!gnl_stats(fd, &s) && (s.reads || s.lines))
+			dprintf(2, "gnl_stats fd %d: %zu reads, %zu bytes read, "
+				"%zu bytes copied, %zu allocs, %zu lines, max stash %zu, "
+				"%zu.%06zu ms blocked\n", fd, s.reads, s.bytes_read,
+				s.bytes_copied, s.allocs, s.lines, s.max_stash,
+				s.blocked_ns / 1000000, s.blocked_ns % 1000000);
+		fd++;
+	}
+}
@@ -0,0 +1,50 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   get_next_line_stats_io.c                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: anemet <anemet@student.42luxembourg.lu>    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:09:23 by anemet            #+#    #+#             */
+/*   Updated: 2026/10/18 09:24:12 by anemet           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "get_next_line_int.h"
+
+// only used through GNL_READ / GNL_WAIT of a GNL_STATS build
+#if GNL_STATS
+# include <time.h>
+
+static size_t	gnl_stat_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((size_t)ts.tv_sec * 1000000000 + ts.tv_nsec);
+}
+
+// gnl_src_read() on the source of r, counted into its stash stats
+ssize_t	gnl_stat_read(t_gnl_reader *r, char *buf, size_t n)
+{
+	size_t	t;
+	ssize_t	rd;
+
+	t = gnl_stat_ns();
+	rd = gnl_src_read(&r->src, r->fd, buf, n);
+	r->st.stats.blocked_ns += gnl_stat_ns() - t;
+	r->st.stats.reads++;
+	if (rd > 0)
+		r->st.stats.bytes_read += rd;
+	return (rd);
+}
+
+void	gnl_stat_wait(t_stash *st, int *addr, int val)
+{
+	size_t	t;
+
+	t = gnl_stat_ns();
+	gnl_wait(addr, val);
+	st->stats.blocked_ns += gnl_stat_ns() - t;
+}
+#endif
@@ -6,88 +6,71 @@
 /*   By: anemet <anemet@student.42.fr>              +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/06/17 10:42:51 by anemet            #+#    #+#             */
-/*   Updated: 2025/06/17 11:17:56 by anemet           ###   ########.fr       */
+/*   Updated: 2026/10/18 07:14:24 by anemet           ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "get_next_line.h"
+#include "get_next_line_int.h"
 
-// return string length
-size_t	gnl_strlen(char *s)
+// forward copy, so it is safe for overlapping ranges as long as dst <= src
+void	gnl_memcpy(char *dst, char *src, size_t n)
 {
 	size_t	i;
 
 	i = 0;
-	while (s && s[i])
-		i++;
-	return (i);
-}
-
-// return pointer to first occurence of 'c' ('c' can be '\0' as well)
-// return NULL if 'c' not in '*s'
-char	*gnl_strchr(char *s, int c)
-{
-	int	i;
-
-	i = 0;
-	while (s && s[i])
+	while (i < n)
 	{
-		if (s[i] == (char)c)
-			return (s + i);
+		dst[i] = src[i];
 		i++;
 	}
-	if (s && c == 0)
-		return (s + i);
-	return (NULL);
 }
 
-// return str = s1 + s2
-// free s1
-char	*gnl_strjoin(char *s1, char *s2)
+void	gnl_bzero(void *p, size_t n)
 {
 	size_t	i;
-	size_t	j;
-	char	*str;
 
-	str = (char *)malloc(gnl_strlen(s1) + gnl_strlen(s2) + 1);
-	if (!str)
-		return (NULL);
 	i = 0;
-	while (s1 && s1[i])
-	{
-		str[i] = s1[i];
-		i++;
-	}
-	j = 0;
-	while (s2 && s2[j])
-	{
-		str[i + j] = s2[j];
-		j++;
-	}
-	str[i + j] = '\0';
-	free(s1);
-	return (str);
+	while (i < n)
+		((char *)p)[i++] = 0;
 }
 
-// allocate, copy and return a slice of s[start .. start + len]
-char	*gnl_substr(char *s, unsigned int start, size_t len)
+// allocate, copy and return a '\0' terminated slice of s[start .. start + len]
+char	*gnl_substr(char *s, size_t start, size_t len)
 {
-	size_t	i;
 	char	*sub;
 
-	if (!s || start >= gnl_strlen(s))
-		return (NULL);
-	if (len > gnl_strlen(s + start))
-		len = gnl_strlen(s + start);
 	sub = malloc(len + 1);
 	if (!sub)
 		return (NULL);
-	i = 0;
-	while (i < len)
-	{
-		sub[i] = s[start + i];
-		i++;
-	}
-	sub[i] = '\0';
+	gnl_memcpy(sub, s + start, len);
+	sub[len] = '\0';
 	return (sub);
 }
+
+// '\0' terminated copy of the next len bytes of the reader's stash
+// (minus the delimiter with opts.strip),
+// from the reader's arena if it has one, malloc'd otherwise
+char	*gnl_line(t_gnl_reader *r, size_t len)
+{
+	char	*line;
+
+	len = gnl_keep(r, len);
+	GNL_STAT(&r->st, bytes_copied, len);
+	GNL_STAT(&r->st, allocs, !r->opts.arena);
+	if (!r->opts.arena)
+		return (gnl_substr(r->st.buf, r->st.off, len));
+	line = gnl_arena_alloc(r->opts.arena, len + 1);
+	if (!line)
+		return (NULL);
+	gnl_memcpy(line, r->st.buf + r->st.off, len);
+	line[len] = '\0';
+	return (line);
+}
+
+// sleep while *addr == val (futex on linux, yield elsewhere)
+// whoever changes *addr wakes the sleeper with GNL_FUTEX_WAKE(addr)
+void	gnl_wait(int *addr, int val)
+{
+	while (__atomic_load_n(addr, __ATOMIC_ACQUIRE) == val)
+		GNL_FUTEX_WAIT(addr, val);
+}